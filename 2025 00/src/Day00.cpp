@@ -0,0 +1,50 @@
+/*
+This will act as a standard template for all Advent of Code 2025 C++ projects 
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+#include "InputLoader.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+
+
+namespace Day00
+{
+
+struct ParsedInput
+{
+    //Everything the problems need from the input, made in the run arena, which drops it once both problems are answered
+    InputLines* p_InputDataVector {nullptr};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    //Turn the puzzle input into something the problems can work with, for the template that is just the lines
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    //Quick test to see if the input loaded correctly
+    return "First Line: " + std::string(p_Parsed->p_InputDataVector->front());
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return "Last Line:  " + std::string(p_Parsed->p_InputDataVector->back());
+}
+
+} //namespace Day00
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day00::ParsedInput>(0, '\n', Day00::ParseInput, Day00::AnswerProblemOne, Day00::AnswerProblemTwo)};
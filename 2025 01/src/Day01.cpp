@@ -0,0 +1,850 @@
+/*
+Problem 1 approach:
+    Since each value can only be between 0 and 99, there are a total of 100 options
+    So each turn, whether left OR right, has to be modulo'd by 100 to get the relative turn, disregarding "full turns"
+        -A turn of 19  will be a turn of 19
+        -A turn of 100 will be a turn of 0, essentially nothing has changed
+        -A turn of 101 will be a turn of 1, counting the first 100 as a "full turn"
+
+    This will be known as the Turn Window
+    
+    
+    Right turns simply increment the current value by the Turn Window
+        This means a right turn can be higher than 99 
+    Left turns decrement, or seen from another angle; increment the current value by (100 - Turn Window) 
+        This means a left turn can never go below 0
+
+    Lastly, since a right turn can go over 99, the final value has one more % 100 step to bring it within the 0-99 range
+
+    if a Current value is 0, tally it
+
+Problem 2 approach:
+    There are 4 options to tally and test for  
+        1. The dial ends up at 0               >>> Test if CurrentValue % TotalOptions == 0             
+        2. The dial ends up overshooting 99    >>> Test if CurrentValue + Window > (TotalOptions - 1)
+        3. The dial ends up undershooting 0    >>> Test if CurrentValue - Window is negative
+        4. The dial does multiple turns        >>> Floor divide Clicks by TotalOptions 
+
+    Using Problem 1's approach as a basic framework, isolate each of these 4 separate cases and tally them individually
+
+Fast engine (--engine=fast):
+    Both problems turn the exact same dial, so the fast engine turns it once and keeps both tallies as it goes
+    It never indexes the lines, it walks the raw input bytes (WholeInput) a block of DialBlockSize instructions at a time:
+
+        1. Find where the next lines end, 8 bytes at a time, then parse each of them into flat arrays of clicks and
+           directions. With both ends of every line known, no line has to wait for the one before it
+        2. Per instruction, the full turns and the step it moves the dial forward (Turn Window, or 100 - Turn Window)
+           None of this depends on the dial, a straight loop over the arrays without branches
+        3. Turn the dial through the block: the only serial part, one add, one compare and a conditional subtract each
+
+    Whether a turn goes L or R is a coin flip in the input, so nothing in the loops branches on it
+
+    Counting every step forward, a right turn passes 0 when it goes beyond 100, a left turn when it stays below 100
+    without having started at 0, and landing on 0 is the same check for both problems
+    Nothing is allocated, the block arrays live on the stack, and the tallies are 64 bit so 10^9 instructions fit
+
+    With --day-threads the input is cut into chunks at line starts and the chunks are scanned in parallel
+    The dial position is a running sum modulo 100, so a chunk does not need to know where it starts: it follows the
+    dial relative to its start, and per turn records the range of start positions for which that turn passes 0
+    (one +1 and one -1 in a difference array) and the one start position for which it lands on 0
+    A serial pass over the chunks then fixes up their start positions, each chunk's tallies are a lookup at its start
+
+Queries (--queries=50/100,0/1000):
+    The puzzle fixes the dial at 100 positions starting on 50, AnswerDialQueries takes any list of start/positions pairs
+    and answers both problems for all of them in one sweep, every block of instructions is parsed only once
+    Queries with the same number of positions share their steps, so those are worked out once per dial size and block
+    (with the division done as a multiply, the dial size is only known at runtime), then the start positions are turned
+    side by side in lanes of DialQueryLanes, one vector register operation per instruction for several queries
+
+Checkpoint (--checkpoint):
+    Where the dial ends up and both tallies are all an instruction ever needs, so they are the whole checkpoint state
+    ResumeBothProblems picks them up, turns the dial through the appended lines with the fast engine and saves them again
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <memory_resource>
+
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "SolverRegistry.h"
+#include "ThreadPool.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day01
+{
+
+void TurnDialOne(std::string_view Line, int& CurrentValue, int TotalOptions, long unsigned int& TallyZeroes)
+{
+    //Apply a single instruction for problem one, tallying if the dial lands on 0
+
+    //Determine the Turn Window
+    int TurnWindow = NumberParsing::ToUnsigned<int>(Line.substr(1)) % TotalOptions;
+
+    //Differentiate between Left and Right
+    if(Line[0] == 'R')
+    {
+        CurrentValue += TurnWindow;
+    }
+    else if(Line[0] == 'L') //could just be 'else', but verbose for clarity
+    {
+        CurrentValue += (TotalOptions - TurnWindow);
+    }
+
+    //Scale back to the 0-99 range
+    CurrentValue = CurrentValue % TotalOptions;
+
+    //Check for zeroes
+    if(!CurrentValue){++TallyZeroes;}
+}
+
+
+void TurnDialTwo(std::string_view Line, int& CurrentValue, int TotalOptions, long unsigned int& TallyZeroes)
+{
+    //Apply a single instruction for problem two, tallying every time the dial passes or lands on 0
+
+    //Isolating the number of clicks 
+    int Clicks {NumberParsing::ToUnsigned<int>(Line.substr(1))};
+
+    //See how many full turns are executed
+    TallyZeroes += Clicks / TotalOptions;
+
+    //Determine the Turn Window
+    int TurnWindow = Clicks % TotalOptions;
+
+    //Differentiate between Left and Right
+    if(Line[0] == 'R')
+    {
+        CurrentValue += TurnWindow;
+
+        if((CurrentValue > (TotalOptions - 1)) && (CurrentValue % TotalOptions))
+        {
+            //The Current Value is higher than 99, so it must've passed 0
+            //If it IS zero, this is excluded, to stop double counting
+            ++TallyZeroes;
+        }
+    }
+    else if(Line[0] == 'L') //could just be 'else', but verbose for clarity
+    {
+        if(((CurrentValue - TurnWindow) < 0) && (CurrentValue % TotalOptions))
+        {
+            //The Current Value is negative, so it must've passed 0
+            //If it IS zero, this is excluded, to stop double counting
+            ++TallyZeroes;
+        }
+        CurrentValue += (TotalOptions - TurnWindow);
+    }
+
+    //Scale back to the 0-99 range
+    CurrentValue = CurrentValue % TotalOptions;
+
+    //Check for zeroes that have not been counted before
+    if(!CurrentValue){++TallyZeroes;}
+}
+
+
+long unsigned int SolveProblemOne(int& Timed, InputLines*& p_VectorInput, int CurrentValue, int TotalOptions)
+{
+    if(Timed){std::cout << "Starting Problem One:  "; PrintTimeNow();}
+
+    //Keep track of how often it lands on 0
+    long unsigned int TallyZeroes {0};
+
+    //Go through each instruction in the vector
+    for(std::string_view Line : (*p_VectorInput))
+    {
+        TurnDialOne(Line, CurrentValue, TotalOptions, TallyZeroes);
+    }
+
+    if(Timed){std::cout << "Ending Problem One:    "; PrintTimeNow();}
+
+    return TallyZeroes;
+}
+
+
+long unsigned int SolveProblemTwo(int& Timed, InputLines*& p_VectorInput, int CurrentValue, int TotalOptions)
+{
+    if(Timed){std::cout << "Starting Problem Two:  "; PrintTimeNow();}
+
+    //Keep track of how often 0 is PASSED
+    long unsigned int TallyZeroes {0};
+
+    //Go through each instruction in the vector
+    for(std::string_view Line : (*p_VectorInput))
+    {
+        TurnDialTwo(Line, CurrentValue, TotalOptions, TallyZeroes);
+    }
+
+    if(Timed){std::cout << "Ending Problem Two:    "; PrintTimeNow();}
+
+    return TallyZeroes;
+}
+
+
+struct ParsedInput
+{
+    //Both problems walk the raw instruction lines
+    InputLines* p_InputDataVector {nullptr};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_InputDataVector, 50, 100));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_InputDataVector, 50, 100));
+}
+
+void StreamBothProblems(RunOptions& Options, LineStream& InputStream, std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //Each instruction only ever depends on where the dial currently is, so both dials can be turned
+    //side by side while the input streams past, without ever holding more than one line
+
+    if(Options.Timed){std::cout << "Starting streamed Problem One and Two:  "; PrintTimeNow();}
+
+    int CurrentValueOne {50};
+    int CurrentValueTwo {50};
+    //A piped input has no size limit, so the tallies get the same width as the fast engine's DialState
+    long unsigned int TallyZeroesOne {0};
+    long unsigned int TallyZeroesTwo {0};
+
+    std::string_view Line;
+    while(InputStream.NextLine(Line))
+    {
+        if(Line.empty()){continue;}
+
+        TurnDialOne(Line, CurrentValueOne, 100, TallyZeroesOne);
+        TurnDialTwo(Line, CurrentValueTwo, 100, TallyZeroesTwo);
+    }
+
+    AnswerOne = std::to_string(TallyZeroesOne);
+    AnswerTwo = std::to_string(TallyZeroesTwo);
+
+    if(Options.Timed){std::cout << "Ending streamed Problem One and Two:    "; PrintTimeNow();}
+}
+
+
+constexpr int DialOptions {100};
+constexpr int DialBlockSize {4096};       //Instructions per block, the block arrays stay well within L1
+constexpr std::size_t DialChunkBytes {1 << 20};     //Smallest chunk of input TurnDialParallel hands to a thread
+
+
+struct DialState
+{
+    //Where the dial is and what has been tallied so far, enough to carry on from anywhere in the instructions
+    int CurrentValue {50};
+    long unsigned int LandedZeroes {0};     //Problem one
+    long unsigned int PassedZeroes {0};     //Problem two
+};
+
+
+struct DialQuery
+{
+    //One variation of the puzzle: where the dial starts, and how many positions it has
+    std::uint32_t Start {50};
+    std::uint32_t TotalOptions {DialOptions};
+};
+
+
+struct DialQueryResult
+{
+    long unsigned int LandedZeroes {0};     //Problem one's question
+    long unsigned int PassedZeroes {0};     //Problem two's question
+};
+
+
+int FindLineEnds(std::string_view Instructions, std::size_t* p_LineEnds, std::size_t& Used)
+{
+    //Offsets of the next (up to) DialBlockSize newlines, 8 bytes at a time, Used is how far the search got
+    //The last line of the input counts as ended by the end of the input, newline or not
+    const char* p_Data {Instructions.data()};
+    std::size_t Size {Instructions.size()};
+    std::size_t Offset {0};
+    int Count {0};
+
+    //Room for a word full of newlines (empty lines) keeps the writes below unconditional
+    while(Offset + 8 <= Size && Count <= DialBlockSize - 8)
+    {
+        //0x80 in every byte that is a newline, exactly, the usual zero byte test after xor-ing the newlines to zero
+        std::uint64_t Word {NumberParsing::LoadEightCharacters(p_Data + Offset) ^ 0x0A0A0A0A0A0A0A0A};
+        std::uint64_t Newlines {~(((Word & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F) | Word | 0x7F7F7F7F7F7F7F7F)};
+        int Found {(int)(((Newlines >> 7) * 0x0101010101010101) >> 56)};
+
+        //Instructions are 3 bytes or more, so a word almost never holds more than 3 newlines, always write those 3
+        //without looking and only loop for the rest, which keeps the number of newlines from ever being a branch
+        for(int i_Found {0}; i_Found < 3; ++i_Found)
+        {
+            p_LineEnds[Count + i_Found] = Offset + (__builtin_ctzll(Newlines | 1ULL << 63) >> 3);
+            Newlines &= Newlines - 1;
+        }
+        for(int i_Found {3}; Newlines; ++i_Found)
+        {
+            p_LineEnds[Count + i_Found] = Offset + (__builtin_ctzll(Newlines) >> 3);
+            Newlines &= Newlines - 1;
+        }
+
+        Count += Found;
+        Offset += 8;
+    }
+
+    //The last few bytes of the input, one at a time
+    if(Offset + 8 > Size)
+    {
+        for(; Offset < Size && Count < DialBlockSize; ++Offset)
+        {
+            if(p_Data[Offset] == '\n'){p_LineEnds[Count++] = Offset;}
+        }
+        if(Offset == Size && Count < DialBlockSize && (!Count || p_LineEnds[Count - 1] + 1 < Size)){p_LineEnds[Count++] = Size;}
+    }
+
+    //Continue right after the last complete line
+    Used = Count ? std::min(p_LineEnds[Count - 1] + 1, Size) : Offset;
+    return Count;
+}
+
+
+int ParseDialBlock(std::string_view Instructions, std::size_t& Used, std::uint32_t* p_Clicks, std::uint8_t* p_Directions)
+{
+    //Fill the block arrays from the raw bytes, returns the number of instructions and how many bytes they took up
+    //Directions has bit 0 set for R, and bit 1 for neither L nor R: the reference leaves the dial where it is for those
+    //but still counts their full turns
+    std::size_t LineEnds[DialBlockSize];
+    int Lines {FindLineEnds(Instructions, LineEnds, Used)};
+
+    const char* p_Data {Instructions.data()};
+    std::size_t Size {Instructions.size()};
+    std::size_t LineStart {0};
+    int Count {0};
+
+    //Every line knows where it starts and ends now, so no line has to wait for the one before it to be parsed
+    for(int i_Line {0}; i_Line < Lines; ++i_Line)
+    {
+        std::size_t LineEnd {LineEnds[i_Line]};
+        const char* p_Line {p_Data + LineStart};
+        std::size_t Length {LineEnd - LineStart};
+        if(Length && p_Line[Length - 1] == '\r'){--Length;}
+
+        //Letter and 1 to 8 digits, with 8 more bytes to read: one load, the mask only checks the digits of this line
+        std::size_t Digits {Length - 1};
+        std::uint32_t Clicks {0};
+        std::uint64_t DigitValues {0};
+        bool Simple {Length >= 2 && Digits <= 8 && LineStart + 9 <= Size};
+        if(Simple)
+        {
+            DigitValues = (NumberParsing::LoadEightCharacters(p_Line + 1) ^ 0x3030303030303030) << (64 - 8 * Digits);
+            Simple = !NumberParsing::GetNonDigitMask(DigitValues);
+        }
+
+        if(Simple){Clicks = NumberParsing::CombineEightDigits(DigitValues);}
+        else if(Length){Clicks = NumberParsing::ToUnsigned<std::uint32_t>(std::string_view(p_Line + 1, Length - 1));}
+
+        //L or R is a coin flip in the input, so this has to stay clear of branches as well
+        char Direction {Length ? p_Line[0] : 'R'};
+        std::uint32_t Left {Direction == 'L'};
+        std::uint32_t Still {(Left ^ 1) & (Direction != 'R')};
+
+        //Empty lines are written over by the next instruction, the reference never sees those
+        p_Clicks[Count] = Clicks;
+        p_Directions[Count] = (std::uint8_t)((Left ^ 1) | Still << 1);
+        Count += Length != 0;
+
+        LineStart = LineEnd + 1;
+    }
+
+    return Count;
+}
+
+
+long unsigned int GetDialSteps(const std::uint32_t* p_Clicks, const std::uint8_t* p_Directions, int Count, std::uint32_t* p_Steps)
+{
+    //Steps and full turns do not depend on the dial, work those out for the whole block first, returns the full turns
+    long unsigned int FullTurns {0};
+    for(int i_Block {0}; i_Block < Count; ++i_Block)
+    {
+        std::uint32_t Clicks {p_Clicks[i_Block]};
+        std::uint32_t TurnWindow {Clicks % DialOptions};
+
+        //All ones for a left turn, so it adds 100 - 2 * Turn Window on top of the Turn Window, masks instead of a branch
+        std::uint32_t LeftMask {(p_Directions[i_Block] & 1U) - 1};
+        std::uint32_t StillMask {0 - (std::uint32_t)(p_Directions[i_Block] >> 1)};
+
+        //Neither L nor R, step 0, and as a right turn of 0 it can not pass 0 either
+        FullTurns += Clicks / DialOptions;
+        p_Steps[i_Block] = (TurnWindow + (LeftMask & (DialOptions - 2 * TurnWindow))) & ~StillMask;
+    }
+
+    return FullTurns;
+}
+
+
+void TurnDialBlock(const std::uint32_t* p_Clicks, const std::uint8_t* p_Directions, int Count, DialState& Dial)
+{
+    std::uint32_t Steps[DialBlockSize];
+    long unsigned int FullTurns {GetDialSteps(p_Clicks, p_Directions, Count, Steps)};
+
+    //Then turn the dial, written without branches since whether 0 is passed is down to the input
+    int CurrentValue {Dial.CurrentValue};
+    std::uint32_t Passes {0};
+    std::uint32_t Landings {0};
+    for(int i_Block {0}; i_Block < Count; ++i_Block)
+    {
+        int NextValue {CurrentValue + (int)Steps[i_Block]};
+        std::uint32_t Right {p_Directions[i_Block] & 1U};
+
+        Passes += (Right & (NextValue > DialOptions)) | ((Right ^ 1) & (NextValue < DialOptions) & (CurrentValue != 0));
+        CurrentValue = NextValue >= DialOptions ? NextValue - DialOptions : NextValue;
+        Landings += CurrentValue == 0;
+    }
+
+    Dial.CurrentValue = CurrentValue;
+    Dial.LandedZeroes += Landings;
+    Dial.PassedZeroes += FullTurns + Passes + Landings;
+}
+
+
+void TurnDialFast(std::string_view Instructions, DialState& Dial)
+{
+    //Instructions has to start at the start of a line, the last one may go without its newline
+    std::uint32_t Clicks[DialBlockSize];
+    std::uint8_t Directions[DialBlockSize];
+
+    while(!Instructions.empty())
+    {
+        std::size_t Used {0};
+        int Count {ParseDialBlock(Instructions, Used, Clicks, Directions)};
+        TurnDialBlock(Clicks, Directions, Count, Dial);
+        Instructions.remove_prefix(Used);
+    }
+}
+
+
+struct DialChunk
+{
+    //What a chunk of instructions does to the dial for every position it could start in, so chunks can be scanned
+    //side by side before anyone knows where the dial will be when their turn comes
+
+    int Offset {0};                     //Where the dial ends up relative to where it started
+    long unsigned int FullTurns {0};
+
+    //Landings[Start] is how often the dial lands on 0 when the chunk starts at Start
+    std::int64_t Landings[DialOptions] {};
+
+    //Difference array over start positions for passing 0, twice around the dial so a range of start positions that
+    //wraps past 99 is still just one +1 and one -1, the two laps are added back together in CountPasses
+    std::int64_t Passes[2 * DialOptions + 1] {};
+
+    long unsigned int CountPasses(int Start) const
+    {
+        //Ranges covering Start on the first lap, plus those covering it on the second
+        std::int64_t Running {0};
+        std::int64_t Total {0};
+        for(int i_Start {0}; i_Start <= Start + DialOptions; ++i_Start)
+        {
+            Running += Passes[i_Start];
+            if(i_Start == Start || i_Start == Start + DialOptions){Total += Running;}
+        }
+        return (long unsigned int)Total;
+    }
+};
+
+
+void ScanDialBlock(const std::uint32_t* p_Clicks, const std::uint8_t* p_Directions, int Count, DialChunk& Chunk)
+{
+    std::uint32_t Steps[DialBlockSize];
+    Chunk.FullTurns += GetDialSteps(p_Clicks, p_Directions, Count, Steps);
+
+    //The dial is at (Start + Relative) % 100, follow Relative and record for which Start each turn hits 0
+    int Relative {Chunk.Offset};
+    for(int i_Block {0}; i_Block < Count; ++i_Block)
+    {
+        int Step {(int)Steps[i_Block]};
+        int Right {p_Directions[i_Block] & 1};
+        int TurnWindow {Step + ((Right - 1) & (DialOptions - 2 * Step))};
+
+        //From where the dial is, a right turn passes 0 from 101 - Turn Window up to 99, a left turn from 1 up to
+        //Turn Window - 1, the same ranges as the reference checks. Shifted back by Relative to get start positions
+        int First {1 + ((0 - Right) & (DialOptions - TurnWindow))};
+        int Lowest {(First - Relative + DialOptions) % DialOptions};
+        ++Chunk.Passes[Lowest];
+        --Chunk.Passes[Lowest + std::max(TurnWindow - 1, 0)];
+
+        Relative += Step;
+        Relative = Relative >= DialOptions ? Relative - DialOptions : Relative;
+        ++Chunk.Landings[Relative ? DialOptions - Relative : 0];
+    }
+
+    Chunk.Offset = Relative;
+}
+
+
+void ScanDialChunk(std::string_view Instructions, DialChunk& Chunk)
+{
+    TraceSpan Span {"ScanDialChunk"};
+
+    std::uint32_t Clicks[DialBlockSize];
+    std::uint8_t Directions[DialBlockSize];
+
+    //Built on the stack and copied out at the end, chunks next to each other in memory do not share cache lines while scanning
+    DialChunk Scanned {};
+    while(!Instructions.empty())
+    {
+        std::size_t Used {0};
+        int Count {ParseDialBlock(Instructions, Used, Clicks, Directions)};
+        ScanDialBlock(Clicks, Directions, Count, Scanned);
+        Instructions.remove_prefix(Used);
+    }
+
+    Chunk = Scanned;
+}
+
+
+void TurnDialParallel(RunOptions& Options, std::string_view Instructions, DialState& Dial)
+{
+    //Scan the chunks on every thread, then walk them in order: each now knows where it starts, so its tallies are a lookup
+    ThreadPool Pool(Options.DayThreads);
+
+    //A few chunks per thread so a slow one does not hold up the rest, but not so small that the scan is all overhead
+    std::size_t ChunkCount {std::max<std::size_t>(1, std::min<std::size_t>(4 * Pool.GetThreadCount(), Instructions.size() / DialChunkBytes))};
+    std::pmr::vector<DialChunk> Chunks(ChunkCount, Options.p_Arena);
+
+    std::size_t ChunkStart {0};
+    for(std::size_t i_Chunk {0}; i_Chunk < ChunkCount; ++i_Chunk)
+    {
+        //Every chunk ends right after a newline, apart from the last which takes whatever is left
+        std::size_t ChunkEnd {Instructions.size()};
+        if(i_Chunk + 1 < ChunkCount)
+        {
+            ChunkEnd = std::max(ChunkStart, Instructions.size() * (i_Chunk + 1) / ChunkCount);
+            std::size_t Newline {Instructions.find('\n', ChunkEnd)};
+            ChunkEnd = Newline == std::string_view::npos ? Instructions.size() : Newline + 1;
+        }
+
+        std::string_view Chunk {Instructions.substr(ChunkStart, ChunkEnd - ChunkStart)};
+        DialChunk* p_Chunk {&Chunks[i_Chunk]};
+        Pool.Submit([Chunk, p_Chunk](){ScanDialChunk(Chunk, *p_Chunk);});
+
+        ChunkStart = ChunkEnd;
+    }
+    Pool.Wait();
+
+    for(DialChunk& Chunk : Chunks)
+    {
+        int Start {Dial.CurrentValue};
+        long unsigned int Landings {(long unsigned int)Chunk.Landings[Start]};
+
+        Dial.LandedZeroes += Landings;
+        Dial.PassedZeroes += Chunk.FullTurns + Chunk.CountPasses(Start) + Landings;
+        Dial.CurrentValue = (Start + Chunk.Offset) % DialOptions;
+    }
+}
+
+
+struct FastInput
+{
+    std::string_view Instructions {};
+    bool Solved {false};
+    DialState Dial {};
+};
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    //Registered with WholeInput, so the one line is the whole input
+    FastInput* p_Parsed = Options.p_Arena->Create<FastInput>();
+    if(!p_InputDataVector->empty()){p_Parsed->Instructions = (*p_InputDataVector)[0];}
+
+    return p_Parsed;
+}
+
+
+void TurnDial(RunOptions& Options, std::string_view Instructions, DialState& Dial)
+{
+    TraceSpan Span {"TurnDialFast"};
+
+    //Threads only pay off once the input is a good few chunks long
+    if(Options.DayThreads != 1 && Instructions.size() >= 4 * DialChunkBytes)
+    {
+        TurnDialParallel(Options, Instructions, Dial);
+    }
+    else
+    {
+        TurnDialFast(Instructions, Dial);
+    }
+}
+
+
+void FastSolveBothProblems(RunOptions& Options, FastInput* p_Parsed)
+{
+    TurnDial(Options, p_Parsed->Instructions, p_Parsed->Dial);
+    p_Parsed->Solved = true;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->Dial.LandedZeroes);
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->Dial.PassedZeroes);
+}
+
+
+bool ResumeBothProblems(RunOptions& Options, std::string_view NewInstructions, std::string& State, std::size_t& Used,
+                        std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //Everything an instruction needs is where the dial is, so the state of a checkpoint is the DialState, as text
+    DialState Dial {};
+    if(!State.empty())
+    {
+        std::vector<long unsigned int> Fields {};
+        if(!NumberParsing::ParseList(State, Fields, ' ') || Fields.size() != 3 || Fields[0] >= DialOptions){return false;}
+
+        Dial.CurrentValue = (int)Fields[0];
+        Dial.LandedZeroes = Fields[1];
+        Dial.PassedZeroes = Fields[2];
+    }
+
+    //Only whole lines go into the checkpoint, the last one may not have its newline yet because it is still being written
+    std::size_t LastNewline {NewInstructions.rfind('\n')};
+    Used = LastNewline == std::string_view::npos ? 0 : LastNewline + 1;
+
+    TurnDial(Options, NewInstructions.substr(0, Used), Dial);
+    State = std::to_string(Dial.CurrentValue) + " " + std::to_string(Dial.LandedZeroes) + " " + std::to_string(Dial.PassedZeroes);
+
+    TurnDialFast(NewInstructions.substr(Used), Dial);
+    AnswerOne = std::to_string(Dial.LandedZeroes);
+    AnswerTwo = std::to_string(Dial.PassedZeroes);
+
+    return true;
+}
+
+
+constexpr int DialQueryLanes {8};         //Start positions turned side by side, wide enough to fill two SSE registers
+
+
+struct DialQueryLaneSet
+{
+    //Up to DialQueryLanes queries on the same dial size, unused lanes turn along and are never read
+    std::uint32_t CurrentValue[DialQueryLanes] {};
+    long unsigned int LandedZeroes[DialQueryLanes] {};
+    long unsigned int PassedZeroes[DialQueryLanes] {};
+    int QueryIndex[DialQueryLanes] {-1, -1, -1, -1, -1, -1, -1, -1};
+};
+
+
+struct DialQueryGroup
+{
+    //Every query with this many positions shares its Turn Windows, only the start positions differ
+    std::uint32_t TotalOptions {DialOptions};
+
+    //Division by a dial size only known at runtime, as a multiply (Lemire, Kaser & Kurz, "Faster Remainder by Direct
+    //Computation"), exact for any 32 bit number of clicks and any dial size from 2 up
+    std::uint64_t DivisionMagic {0};
+
+    std::vector<DialQueryLaneSet> LaneSets {};
+};
+
+
+long unsigned int GetQuerySteps(const DialQueryGroup& Group, const std::uint32_t* p_Clicks, const std::uint8_t* p_Directions, int Count, std::uint32_t* p_Steps)
+{
+    //GetDialSteps for any dial size
+    std::uint32_t TotalOptions {Group.TotalOptions};
+    long unsigned int FullTurns {0};
+    for(int i_Block {0}; i_Block < Count; ++i_Block)
+    {
+        std::uint32_t Clicks {p_Clicks[i_Block]};
+        std::uint64_t Fraction {Group.DivisionMagic * Clicks};
+        std::uint32_t TurnWindow {(std::uint32_t)(((unsigned __int128)Fraction * TotalOptions) >> 64)};
+        std::uint32_t LeftMask {(p_Directions[i_Block] & 1U) - 1};
+        std::uint32_t StillMask {0 - (std::uint32_t)(p_Directions[i_Block] >> 1)};
+
+        FullTurns += (long unsigned int)(((unsigned __int128)Group.DivisionMagic * Clicks) >> 64);
+        p_Steps[i_Block] = (TurnWindow + (LeftMask & (TotalOptions - 2 * TurnWindow))) & ~StillMask;
+    }
+
+    return FullTurns;
+}
+
+
+void TurnDialLanes(const std::uint32_t* p_Steps, const std::uint8_t* p_Directions, int Count, std::uint32_t TotalOptions, DialQueryLaneSet& Lanes)
+{
+    //TurnDialBlock for a whole lane set at once: every lane takes the same step, so the inner loop over the lanes has
+    //no dependencies between iterations and no branches, which is what lets the compiler put it in vector registers
+    std::uint32_t CurrentValue[DialQueryLanes];
+    std::uint32_t Passes[DialQueryLanes] {};
+    std::uint32_t Landings[DialQueryLanes] {};
+    for(int i_Lane {0}; i_Lane < DialQueryLanes; ++i_Lane){CurrentValue[i_Lane] = Lanes.CurrentValue[i_Lane];}
+
+    for(int i_Block {0}; i_Block < Count; ++i_Block)
+    {
+        std::uint32_t Step {p_Steps[i_Block]};
+        std::uint32_t Right {p_Directions[i_Block] & 1U};
+
+        for(int i_Lane {0}; i_Lane < DialQueryLanes; ++i_Lane)
+        {
+            std::uint32_t Current {CurrentValue[i_Lane]};
+            std::uint32_t NextValue {Current + Step};
+
+            Passes[i_Lane] += (Right & (NextValue > TotalOptions)) | ((Right ^ 1) & (NextValue < TotalOptions) & (Current != 0));
+            Current = NextValue >= TotalOptions ? NextValue - TotalOptions : NextValue;
+            Landings[i_Lane] += Current == 0;
+            CurrentValue[i_Lane] = Current;
+        }
+    }
+
+    for(int i_Lane {0}; i_Lane < DialQueryLanes; ++i_Lane)
+    {
+        Lanes.CurrentValue[i_Lane] = CurrentValue[i_Lane];
+        Lanes.LandedZeroes[i_Lane] += Landings[i_Lane];
+        Lanes.PassedZeroes[i_Lane] += Passes[i_Lane] + Landings[i_Lane];
+    }
+}
+
+
+bool ParseDialQueries(std::string_view Text, std::vector<DialQuery>& Queries)
+{
+    //"50/100,0/1000": start position / number of positions
+    while(!Text.empty())
+    {
+        std::size_t Comma {std::min(Text.find(','), Text.size())};
+        DialQuery Query {};
+        if(!NumberParsing::ParseRange(Text.substr(0, Comma), Query.Start, Query.TotalOptions, '/'))
+        {
+            std::cout << "Bad dial query: " << Text.substr(0, Comma) << ", expected start/positions like 50/100" << std::endl;
+            return false;
+        }
+        if(Query.TotalOptions < 2 || Query.TotalOptions > (1U << 31) || Query.Start >= Query.TotalOptions)
+        {
+            std::cout << "Bad dial query: " << Text.substr(0, Comma) << ", the dial needs 2 to 2^31 positions and has to start on one of them" << std::endl;
+            return false;
+        }
+
+        Queries.emplace_back(Query);
+        Text.remove_prefix(std::min(Comma + 1, Text.size()));
+    }
+
+    return !Queries.empty();
+}
+
+
+std::vector<DialQueryResult> AnswerDialQueries(std::string_view Instructions, const std::vector<DialQuery>& Queries)
+{
+    //Every query in one sweep: each block of instructions is parsed once, then turned on every dial size and start
+    TraceSpan Span {"AnswerDialQueries"};
+
+    std::vector<DialQueryGroup> Groups {};
+    for(int i_Query {0}; i_Query < (int)Queries.size(); ++i_Query)
+    {
+        const DialQuery& Query {Queries[i_Query]};
+        auto p_Group {std::find_if(Groups.begin(), Groups.end(), [&Query](const DialQueryGroup& Group){return Group.TotalOptions == Query.TotalOptions;})};
+        if(p_Group == Groups.end())
+        {
+            DialQueryGroup Group {};
+            Group.TotalOptions = Query.TotalOptions;
+            Group.DivisionMagic = ~std::uint64_t {0} / Query.TotalOptions + 1;
+            p_Group = Groups.insert(Groups.end(), Group);
+        }
+
+        //Fill the lanes of the last set before starting a new one
+        std::vector<DialQueryLaneSet>& LaneSets {p_Group->LaneSets};
+        if(LaneSets.empty() || LaneSets.back().QueryIndex[DialQueryLanes - 1] >= 0){LaneSets.emplace_back();}
+
+        DialQueryLaneSet& Lanes {LaneSets.back()};
+        int Lane {(int)(std::find(Lanes.QueryIndex, Lanes.QueryIndex + DialQueryLanes, -1) - Lanes.QueryIndex)};
+        Lanes.QueryIndex[Lane] = i_Query;
+        Lanes.CurrentValue[Lane] = Query.Start;
+    }
+
+    std::uint32_t Clicks[DialBlockSize];
+    std::uint8_t Directions[DialBlockSize];
+    std::uint32_t Steps[DialBlockSize];
+    std::vector<long unsigned int> FullTurns(Groups.size(), 0);
+
+    while(!Instructions.empty())
+    {
+        std::size_t Used {0};
+        int Count {ParseDialBlock(Instructions, Used, Clicks, Directions)};
+
+        for(int i_Group {0}; i_Group < (int)Groups.size(); ++i_Group)
+        {
+            DialQueryGroup& Group {Groups[i_Group]};
+            FullTurns[i_Group] += GetQuerySteps(Group, Clicks, Directions, Count, Steps);
+            for(DialQueryLaneSet& Lanes : Group.LaneSets){TurnDialLanes(Steps, Directions, Count, Group.TotalOptions, Lanes);}
+        }
+
+        Instructions.remove_prefix(Used);
+    }
+
+    //Full turns are the same for every start position, so they are only added in at the end
+    std::vector<DialQueryResult> Results(Queries.size());
+    for(int i_Group {0}; i_Group < (int)Groups.size(); ++i_Group)
+    {
+        for(DialQueryLaneSet& Lanes : Groups[i_Group].LaneSets)
+        {
+            for(int i_Lane {0}; i_Lane < DialQueryLanes; ++i_Lane)
+            {
+                if(Lanes.QueryIndex[i_Lane] < 0){continue;}
+
+                DialQueryResult& Result {Results[Lanes.QueryIndex[i_Lane]]};
+                Result.LandedZeroes = Lanes.LandedZeroes[i_Lane];
+                Result.PassedZeroes = Lanes.PassedZeroes[i_Lane] + FullTurns[i_Group];
+            }
+        }
+    }
+
+    return Results;
+}
+
+
+bool AnswerQueries(RunOptions& Options, InputLines* p_InputDataVector, std::vector<std::string>& Answers)
+{
+    std::vector<DialQuery> Queries {};
+    if(!ParseDialQueries(Options.Queries, Queries)){return false;}
+
+    std::vector<DialQueryResult> Results {AnswerDialQueries((*p_InputDataVector)[0], Queries)};
+
+    for(int i_Query {0}; i_Query < (int)Queries.size(); ++i_Query)
+    {
+        Answers.emplace_back(std::to_string(Queries[i_Query].Start) + "/" + std::to_string(Queries[i_Query].TotalOptions)
+                             + "  landed on 0: " + std::to_string(Results[i_Query].LandedZeroes)
+                             + "  passed or landed on 0: " + std::to_string(Results[i_Query].PassedZeroes));
+    }
+
+    return true;
+}
+
+} //namespace Day01
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day01::ParsedInput>(1, '\n', Day01::ParseInput, Day01::AnswerProblemOne, Day01::AnswerProblemTwo)};
+static bool RegisteredStream {RegisterStreamingDay(1, Day01::StreamBothProblems)};
+static bool RegisteredFast {RegisterFastEngine<Day01::FastInput>(1, Day01::FastParseInput, Day01::FastAnswerProblemOne, Day01::FastAnswerProblemTwo, nullptr, true)};
+static bool RegisteredQuery {RegisterQueryDay(1, Day01::AnswerQueries)};
+static bool RegisteredResume {RegisterResumableDay(1, Day01::ResumeBothProblems)};
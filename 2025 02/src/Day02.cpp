@@ -0,0 +1,832 @@
+/*
+Problem 1 approach:
+    Generate invalid IDs and see if they fall within one of the given ranges
+
+    First, create a map where each first range digit links to its max range digit
+        i.e. 11-22 becomes Map[11] = 22
+    Then, start generating invalid IDs by incrementing a counter and doubling the number sequence
+        1 > 11
+        2 > 22
+        .
+        .
+        .
+        123 > 123123
+    Test if the invalid ID is greater than a key in the map, and then if it is smaller than the key's value.
+    If so, this invalid ID exists within the range.
+
+Problem 2 approach:
+    Once again, generate invalid IDs by incrementing a counter and progressively multiply that unit
+
+    11
+    111
+    .
+    .
+    22
+    222
+    .
+    .
+    3434
+    343434
+
+    and so on
+
+    Every segment length and repeat count gives a run of invalid IDs that is already sorted, 34 * 101 = 3434 up to
+    99 * 101 = 9999, so they are built arithmetically, one segment length per thread with --day-threads
+    The runs are then merged into one sorted vector, dropping the duplicates on the way since:
+        21     >  21212121
+        2121   >  21212121
+
+    Then check those against the ranges again.
+
+    Like problem 1, just more obtuse
+
+Matching the invalid IDs against the ranges:
+    Both problems have their invalid IDs in increasing order, so the ranges get flattened into a sorted array with the
+    overlapping ones merged, and both lists are walked side by side, every ID and range is looked at once
+    With far more ranges than IDs, each ID does a branchless binary search over the range starts instead
+
+Fast engine (--engine=fast):
+    The above stays as the reference. Nothing gets generated, the sums come straight out of arithmetic per range:
+
+    An ID of Digits digits made of a block of BlockDigits digits repeated is the block times a repunit
+        123123    = 123 * 1001
+        12121212  = 12 * 1010101
+    So the IDs of that shape in [First, Last] are every block between ceil(First / Repunit) and floor(Last / Repunit),
+    and their sum is Repunit times the sum of that run of blocks, an arithmetic series
+
+    Problem 1 only has the block repeated twice, half the digits, for each digit count in the range
+    Problem 2 takes every block length that divides the digit count, but 1111 is 1 repeated and 11 repeated as well
+    Counting in terms of the shortest block an ID repeats, the IDs repeating BlockDigits digits are exactly the ones whose
+    shortest block divides BlockDigits, so taking those off for every shorter divisor (inclusion-exclusion over the
+    divisors) leaves each invalid ID counted once
+
+    That is a handful of divisions per digit count, the width of a range does not matter, 19 and 20 digit ranges included
+    Overlapping ranges are merged first, the reference counts an ID once no matter how many ranges it falls in
+
+    IDs of up to 19 digits always fit in 64 bits, so the engine is a template on the ID type: the longest number in the
+    input decides between std::uint64_t and unsigned __int128, which takes IDs of up to 38 digits
+    The reference is a template on the ID type the same way, and only generates IDs up to the longest one in the ranges,
+    so both engines sum the same IDs, wrapped around at 64 bits for IDs of up to 19 digits
+    Longer IDs sum in 128 bits, which 38 digit IDs easily go past: the fast engine checks every add and multiply and
+    gives no answer, with a message, for a part whose sum does not fit. The reference never gets that far (see below)
+    Wide ranges of 15 to 17 digit IDs are checked against each other, three seeds each, with
+
+        ./GenerateInput --day=2 --size=20 --digits=17 --width=1000000000000000 --seed=1 --output=wide02.txt
+        ./aoc --day=2 --engine=both wide02.txt
+
+    From 18 digits on only the fast engine gets anywhere, the reference runs out of memory on its 10^9 and more IDs
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory_resource>
+#include <algorithm>
+#include <bit>
+
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "SolverRegistry.h"
+#include "ThreadPool.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day02
+{
+
+template<typename ID>
+std::pmr::map<ID, ID>* GetRangeMap(InputLines* p_VectorOfRangePairs, RunArena& Arena)
+{
+    //Take each int-int pair string and turn it into an map[int] = int 
+    //This could also be done within GetFileData, but separating this for verbose clarity
+    //Since the puzzle input digits get quite large, this needs to be done using long ints
+
+    //Setting up variables to store the long ints in a map
+    std::pmr::map<ID, ID>* p_MapOfRanges = Arena.Create<std::pmr::map<ID, ID>>(&Arena);
+
+    for(std::string_view IntPairString : *p_VectorOfRangePairs)
+    {
+        //Isolating the ints from the string
+        ID RangeMinimum {0};
+        ID RangeMaximum {0};
+        if(!NumberParsing::ParseRange(IntPairString, RangeMinimum, RangeMaximum)){continue;}
+
+        //Add the maximum int as a value to the minimum int's key
+        (*p_MapOfRanges)[RangeMinimum] = RangeMaximum;
+    }
+
+    return p_MapOfRanges;
+}
+
+
+//Digits it takes to write the largest ID of each width, every ID with one digit less always fits
+template<typename ID> constexpr int MaxIDDigits {20};
+template<> constexpr int MaxIDDigits<unsigned __int128> {39};
+
+
+template<typename ID = long unsigned int>
+ID PowerOfTen(int Exponent)
+{
+    ID Power {1};
+    for(int i_Exponent {0}; i_Exponent < Exponent; ++i_Exponent){Power *= 10;}
+
+    return Power;
+}
+
+
+template<typename ID>
+struct IDRange
+{
+    ID First {0};
+    ID Last {0};
+};
+
+
+template<typename ID>
+void MergeSortedRanges(std::pmr::vector<IDRange<ID>>& Ranges)
+{
+    //Ranges sorted by First, no two starting at the same ID, become the union of them: sorted, and none overlapping
+    //Backwards ranges hold no IDs at all, those just go
+    int Merged {0};
+    for(IDRange<ID>& Range : Ranges)
+    {
+        if(Range.First > Range.Last){continue;}
+
+        if(Merged && Range.First <= Ranges[Merged - 1].Last)
+        {
+            Ranges[Merged - 1].Last = std::max(Ranges[Merged - 1].Last, Range.Last);
+            continue;
+        }
+
+        Ranges[Merged++] = Range;
+    }
+    Ranges.resize(Merged);
+}
+
+
+template<typename ID>
+std::pmr::vector<IDRange<ID>>* GetRangeIndex(std::pmr::map<ID, ID>* p_MapOfRanges, RunArena& Arena)
+{
+    //The map's ranges flattened into a sorted array, overlapping ones merged
+    //An ID in overlapping ranges still only counts once, same as breaking out of the loop over the map on the first hit
+    std::pmr::vector<IDRange<ID>>* p_Ranges = Arena.Create<std::pmr::vector<IDRange<ID>>>(&Arena);
+    p_Ranges->reserve(p_MapOfRanges->size());
+
+    for(auto Ranges : *p_MapOfRanges){p_Ranges->emplace_back(IDRange<ID> {Ranges.first, Ranges.second});}
+    MergeSortedRanges(*p_Ranges);
+
+    return p_Ranges;
+}
+
+
+template<typename ID>
+ID SumInvalidIDsSweep(const std::pmr::vector<ID>& SortedInvalidIDs, const std::pmr::vector<IDRange<ID>>& Ranges)
+{
+    //Both sides are sorted, so walk them side by side: the current range only ever moves forward
+    ID SumInvalidIDs {0};
+    const IDRange<ID>* p_Range {Ranges.data()};
+    const IDRange<ID>* p_RangesEnd {Ranges.data() + Ranges.size()};
+
+    for(ID InvalidID : SortedInvalidIDs)
+    {
+        while(p_Range != p_RangesEnd && p_Range->Last < InvalidID){++p_Range;}
+        if(p_Range == p_RangesEnd){break;}
+
+        SumInvalidIDs += InvalidID >= p_Range->First ? InvalidID : 0;
+    }
+
+    return SumInvalidIDs;
+}
+
+
+template<typename ID>
+ID SumInvalidIDsSearch(const std::pmr::vector<ID>& InvalidIDs, const std::pmr::vector<IDRange<ID>>& Ranges)
+{
+    //Far more ranges than IDs, look each ID up on its own instead of walking past all those ranges
+    //The search halves the window without a branch, the compare turns into a conditional move
+    ID SumInvalidIDs {0};
+    if(Ranges.empty()){return 0;}
+
+    for(ID InvalidID : InvalidIDs)
+    {
+        //Ends on the last range starting at or before the ID, or on the first range if there is none
+        const IDRange<ID>* p_Range {Ranges.data()};
+        std::size_t Window {Ranges.size()};
+        while(Window > 1)
+        {
+            std::size_t Half {Window / 2};
+            p_Range = p_Range[Half].First <= InvalidID ? p_Range + Half : p_Range;
+            Window -= Half;
+        }
+
+        SumInvalidIDs += InvalidID >= p_Range->First && InvalidID <= p_Range->Last ? InvalidID : 0;
+    }
+
+    return SumInvalidIDs;
+}
+
+
+template<typename ID>
+ID SumInvalidIDsInRanges(const std::pmr::vector<ID>& SortedInvalidIDs, const std::pmr::vector<IDRange<ID>>& Ranges)
+{
+    //A sweep touches every ID and every range once, a search log2(ranges) ranges per ID, take whichever is less
+    std::size_t IDCount {SortedInvalidIDs.size()};
+    std::size_t SearchSteps {IDCount * std::bit_width(Ranges.size())};
+
+    if(SearchSteps < IDCount + Ranges.size()){return SumInvalidIDsSearch(SortedInvalidIDs, Ranges);}
+
+    return SumInvalidIDsSweep(SortedInvalidIDs, Ranges);
+}
+
+
+template<typename ID>
+int CountDigits(ID FullNumber)
+{
+    //Recursively count how many digits are within a number
+    //You know. For fun!
+
+    if(!(FullNumber / 10))
+    {
+        //If there are no more multiples of 10, we've reached the 1-9 range of digits base case
+        return 1;
+    }
+    
+    //There's still multiples of 10 left, recursively call CountDigits on FullNumber with a digit stripped off
+    return 1 + (CountDigits(FullNumber / 10));
+}
+
+
+template<typename ID>
+int GetMaxRangeDigits(std::pmr::vector<IDRange<ID>>* p_Ranges)
+{
+    //Count the amount of digits in the largest number given in the ranges
+    //The merged ranges are sorted and do not overlap, so that is the end of the last one
+    //The last key in the map is not enough, 1-999999,5-10 ends on 10 but has IDs up to 999999
+    return p_Ranges->empty() ? 0 : CountDigits(p_Ranges->back().Last);
+}
+
+
+template<typename ID>
+ID GetMaxRangeNumber(std::pmr::vector<IDRange<ID>>* p_Ranges)
+{
+    //Figuring out what reasonable max I should set for the increment loop
+
+    //Divide the digits of the largest number by 2, since we're duplicating the number sequence to get the invalid IDs
+    int MaximumDigitsNeeded {GetMaxRangeDigits(p_Ranges) / 2};
+
+    //The largest number with that many digits, all 9s, is one below the next power of ten
+    return PowerOfTen<ID>(MaximumDigitsNeeded) - 1;
+}
+
+
+template<typename ID>
+ID GenerateInvalidID(ID HalfNumber, ID HalfMultiplier)
+{
+    //Take a number half and duplicate it, generating an invalid ID
+    //123 > 123123 is 123 * 1000 + 123, so the half times (10^digits + 1)
+    return HalfNumber * HalfMultiplier;
+}
+
+
+template<typename ID>
+std::pmr::vector<ID>* GetInvalidIDsOne(std::pmr::vector<IDRange<ID>>* p_Ranges, RunArena& Arena)
+{
+    //Generate a whole vector of IDs that are invalid
+    std::pmr::vector<ID>* p_VectorOfInvalidIDs = Arena.Create<std::pmr::vector<ID>>(&Arena);
+
+    //For good practice, figure out a reasonable maximum number
+    //All of this can be replaced by just quickly looking at the input data and plugging in a number
+    //but where would the fun in that be? Let's be robust about it
+    ID MaxIncrement {GetMaxRangeNumber(p_Ranges)};
+    p_VectorOfInvalidIDs->reserve((std::size_t)MaxIncrement);
+
+    //Now build some invalid IDs and check 'em, we can start at 1
+    //The multiplier goes up a power of ten every time the half gains a digit
+    ID NextPowerOfTen {10};
+    for(ID HalfNumber {1}; HalfNumber <= MaxIncrement; ++HalfNumber)
+    {
+        if(HalfNumber == NextPowerOfTen){NextPowerOfTen *= 10;}
+
+        //Grab invalid ID and add it to vector
+        ID InvalidID {GenerateInvalidID(HalfNumber, NextPowerOfTen + 1)};
+        p_VectorOfInvalidIDs->emplace_back(InvalidID);
+    }
+
+    return p_VectorOfInvalidIDs;
+}
+
+
+template<typename ID>
+ID SolveProblemOne(int& Timed, std::pmr::vector<IDRange<ID>>* p_Ranges,  std::pmr::vector<ID>* p_VectorOfInvalidIDs)
+{
+    if(Timed){std::cout << "Starting Problem One:  ";PrintTimeNow();}
+    
+    //The invalid IDs come out of the generator in increasing order, match them against the sorted ranges
+    ID SumInvalidIDs {SumInvalidIDsInRanges(*p_VectorOfInvalidIDs, *p_Ranges)};
+    
+    if(Timed){std::cout << "Ending Problem One:    ";PrintTimeNow();}
+
+    return SumInvalidIDs;
+}
+
+
+struct CandidateRun
+{
+    //Every segment of SegmentDigits digits repeated Repeats times, its candidates go in [Begin, End) of the shared buffer
+    int SegmentDigits {0};
+    int Repeats {0};
+    std::size_t Begin {0};
+    std::size_t End {0};
+};
+
+
+template<typename ID>
+void GenerateCandidateRun(const CandidateRun& Run, ID* p_Candidates)
+{
+    //A segment repeated is the segment times a repunit, 3434 is 34 * 101, so no strings needed
+    //Runs never go past the longest ID in the ranges, so every candidate fits in an ID and the run comes out sorted
+    ID Repunit {0};
+    for(int i_Repeat {0}; i_Repeat < Run.Repeats; ++i_Repeat){Repunit = Repunit * PowerOfTen<ID>(Run.SegmentDigits) + 1;}
+
+    //Counting the segments up from the first one with SegmentDigits digits, one add per candidate
+    ID Candidate {PowerOfTen<ID>(Run.SegmentDigits - 1) * Repunit};
+    for(std::size_t i_Candidate {Run.Begin}; i_Candidate < Run.End; ++i_Candidate)
+    {
+        p_Candidates[i_Candidate] = Candidate;
+        Candidate += Repunit;
+    }
+}
+
+
+template<typename ID>
+std::pmr::vector<ID>* MergeCandidateRuns(std::pmr::vector<ID>& Candidates, std::pmr::vector<CandidateRun>& Runs, RunArena& Arena)
+{
+    //k-way merge of the sorted runs into one sorted vector, a candidate equal to the last one out is a duplicate
+    //21212121 comes out of both the 21 and the 2121 runs, but only goes in once
+    struct RunHead
+    {
+        ID Candidate {0};
+        std::size_t Next {0};
+        std::size_t End {0};
+    };
+
+    std::pmr::vector<RunHead> Heads(&Arena);
+    for(CandidateRun& Run : Runs)
+    {
+        if(Run.Begin < Run.End){Heads.emplace_back(RunHead {Candidates[Run.Begin], Run.Begin + 1, Run.End});}
+    }
+
+    //Min heap on the candidate at the head of each run, there are only a few dozen runs at most
+    auto Later {[](const RunHead& A, const RunHead& B){return A.Candidate > B.Candidate;}};
+    std::make_heap(Heads.begin(), Heads.end(), Later);
+
+    std::pmr::vector<ID>* p_VectorOfInvalidIDs = Arena.Create<std::pmr::vector<ID>>(&Arena);
+    p_VectorOfInvalidIDs->reserve(Candidates.size());
+
+    while(!Heads.empty())
+    {
+        std::pop_heap(Heads.begin(), Heads.end(), Later);
+        RunHead& Head {Heads.back()};
+
+        if(p_VectorOfInvalidIDs->empty() || p_VectorOfInvalidIDs->back() != Head.Candidate){p_VectorOfInvalidIDs->emplace_back(Head.Candidate);}
+
+        if(Head.Next == Head.End)
+        {
+            Heads.pop_back();
+            continue;
+        }
+
+        Head.Candidate = Candidates[Head.Next++];
+        std::push_heap(Heads.begin(), Heads.end(), Later);
+    }
+
+    return p_VectorOfInvalidIDs;
+}
+
+
+template<typename ID>
+std::pmr::vector<ID>* GetInvalidIDsTwo(RunOptions& Options, std::pmr::vector<IDRange<ID>>* p_Ranges)
+{
+    TraceSpan Span {"GetInvalidIDsTwo"};
+    RunArena& Arena {*Options.p_Arena};
+
+    //Essentially already did this for problem 1, but might as well run it again
+    int MaximumDigitsAllowed {GetMaxRangeDigits(p_Ranges)};
+
+    //Segments run up to half the digits, and each one keeps being repeated as long as it fits in MaximumDigitsAllowed
+    //Anything longer is in none of the ranges, and past the width of an ID it would wrap around into ones that are
+    //Every segment length and repeat count is a run of candidates, laid out next to each other in one buffer
+    std::pmr::vector<CandidateRun> Runs(&Arena);
+    std::size_t CandidateCount {0};
+    for(int SegmentDigits {1}; SegmentDigits <= MaximumDigitsAllowed / 2; ++SegmentDigits)
+    {
+        for(int Repeats {2}; SegmentDigits * Repeats <= MaximumDigitsAllowed; ++Repeats)
+        {
+            std::size_t Segments {9 * PowerOfTen(SegmentDigits - 1)};
+            Runs.emplace_back(CandidateRun {SegmentDigits, Repeats, CandidateCount, CandidateCount + Segments});
+            CandidateCount += Segments;
+        }
+    }
+
+    std::pmr::vector<ID> Candidates(CandidateCount, &Arena);
+
+    if(Options.DayThreads != 1)
+    {
+        //One task per segment length, the longest segments have by far the most candidates so they go in first
+        ThreadPool Pool(Options.DayThreads);
+        for(int SegmentDigits {MaximumDigitsAllowed / 2}; SegmentDigits >= 1; --SegmentDigits)
+        {
+            Pool.Submit([&Runs, &Candidates, SegmentDigits]()
+            {
+                for(CandidateRun& Run : Runs)
+                {
+                    if(Run.SegmentDigits == SegmentDigits){GenerateCandidateRun(Run, Candidates.data());}
+                }
+            });
+        }
+        Pool.Wait();
+    }
+    else
+    {
+        for(CandidateRun& Run : Runs){GenerateCandidateRun(Run, Candidates.data());}
+    }
+
+    return MergeCandidateRuns(Candidates, Runs, Arena);
+}
+
+
+template<typename ID>
+ID SolveProblemTwo(int& Timed, std::pmr::vector<IDRange<ID>>* p_Ranges,  std::pmr::vector<ID>* p_VectorOfInvalidIDs)
+{
+    if(Timed){std::cout << "Starting Problem Two:  ";PrintTimeNow();}
+    
+    //The merge left the invalid IDs sorted, same matching as Problem 1
+    ID SumInvalidIDs {SumInvalidIDsInRanges(*p_VectorOfInvalidIDs, *p_Ranges)};
+    
+    if(Timed){std::cout << "Ending Problem Two:    ";PrintTimeNow();}
+
+    return SumInvalidIDs;
+}
+
+
+int CountFieldDigits(std::string_view Field)
+{
+    //Digits of the number in a field, leading spaces and zeros do not count
+    std::size_t First {Field.find_first_not_of(" 0")};
+    std::size_t Last {Field.find_last_not_of(' ')};
+
+    return First == std::string_view::npos || Last < First ? 0 : (int)(Last - First + 1);
+}
+
+
+int GetMaxIDDigits(InputLines* p_VectorOfRangePairs)
+{
+    //Longest number in the input, before any of it gets parsed into something too narrow
+    //The length of the text on either side of the '-' is enough, only a field too long for 64 bits gets a closer look
+    int MaxDigits {0};
+    for(std::string_view IntPairString : *p_VectorOfRangePairs)
+    {
+        std::size_t Separator {std::min(IntPairString.find('-'), IntPairString.size())};
+        std::size_t FieldLength {std::max(Separator, IntPairString.size() - std::min(Separator + 1, IntPairString.size()))};
+        if(FieldLength < (std::size_t)MaxIDDigits<std::uint64_t>){continue;}
+
+        MaxDigits = std::max(MaxDigits, CountFieldDigits(IntPairString.substr(0, Separator)));
+        if(Separator < IntPairString.size()){MaxDigits = std::max(MaxDigits, CountFieldDigits(IntPairString.substr(Separator + 1)));}
+    }
+
+    return MaxDigits;
+}
+
+
+std::string WideIDToString(unsigned __int128 Value)
+{
+    //std::to_string stops at 64 bits, so write the digits out from the back
+    char Digits[MaxIDDigits<unsigned __int128>] {};
+    int Used {0};
+    do
+    {
+        Digits[sizeof(Digits) - ++Used] = (char)('0' + (int)(Value % 10));
+        Value /= 10;
+    } while(Value);
+
+    return std::string(Digits + sizeof(Digits) - Used, Used);
+}
+
+
+bool IDsFitIn128Bits(int MaxDigits)
+{
+    //Only false, with a message, for IDs too long for even the widest ID type
+    if(MaxDigits < MaxIDDigits<unsigned __int128>){return true;}
+
+    std::cout << "IDs of " << MaxDigits << " digits do not fit in 128 bits, the longest one can have "
+              << MaxIDDigits<unsigned __int128> - 1 << std::endl;
+    return false;
+}
+
+
+template<typename ID>
+struct ReferenceIDs
+{
+    //The ranges and both collections of invalid IDs, at one ID width
+    std::pmr::map<ID, ID>* p_MapOfRanges {nullptr};
+    std::pmr::vector<IDRange<ID>>* p_Ranges {nullptr};
+    std::pmr::vector<ID>* p_VectorOfInvalidIDsOne {nullptr};
+    std::pmr::vector<ID>* p_VectorOfInvalidIDsTwo {nullptr};
+};
+
+
+struct ParsedInput
+{
+    //All of it in the run arena, which cleans up after the runner is done
+    //IDs up to 19 digits always fit in 64 bits, longer ones go in 128 bits, only one of the two is filled in
+    ReferenceIDs<long unsigned int>* p_IDs {nullptr};
+    ReferenceIDs<unsigned __int128>* p_WideIDs {nullptr};
+};
+
+
+template<typename ID>
+ReferenceIDs<ID>* GetReferenceIDs(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ReferenceIDs<ID>* p_IDs = Arena.Create<ReferenceIDs<ID>>();
+
+    //Changing the puzzle input from strings to a map of ints
+    p_IDs->p_MapOfRanges = GetRangeMap<ID>(p_InputDataVector, Arena);
+    p_IDs->p_Ranges = GetRangeIndex(p_IDs->p_MapOfRanges, Arena);
+
+    //All invalid IDs for Problem 1
+    p_IDs->p_VectorOfInvalidIDsOne = GetInvalidIDsOne(p_IDs->p_Ranges, Arena);
+
+    //All invalid IDs for Problem 2, merged from sorted runs to stop duplicate entries
+    p_IDs->p_VectorOfInvalidIDsTwo = GetInvalidIDsTwo(Options, p_IDs->p_Ranges);
+
+    return p_IDs;
+}
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+
+    //The longest number in the input decides how wide the IDs have to be, same as for the fast engine
+    int MaxDigits {GetMaxIDDigits(p_InputDataVector)};
+    if(MaxDigits < MaxIDDigits<long unsigned int>){p_Parsed->p_IDs = GetReferenceIDs<long unsigned int>(Options, p_InputDataVector);}
+    else if(IDsFitIn128Bits(MaxDigits)){p_Parsed->p_WideIDs = GetReferenceIDs<unsigned __int128>(Options, p_InputDataVector);}
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    if(p_Parsed->p_IDs){return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_IDs->p_Ranges, p_Parsed->p_IDs->p_VectorOfInvalidIDsOne));}
+    if(p_Parsed->p_WideIDs){return WideIDToString(SolveProblemOne(Options.Timed, p_Parsed->p_WideIDs->p_Ranges, p_Parsed->p_WideIDs->p_VectorOfInvalidIDsOne));}
+
+    return "";
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    if(p_Parsed->p_IDs){return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_IDs->p_Ranges, p_Parsed->p_IDs->p_VectorOfInvalidIDsTwo));}
+    if(p_Parsed->p_WideIDs){return WideIDToString(SolveProblemTwo(Options.Timed, p_Parsed->p_WideIDs->p_Ranges, p_Parsed->p_WideIDs->p_VectorOfInvalidIDsTwo));}
+
+    return "";
+}
+
+
+template<typename ID>
+ID AddChecked(ID A, ID B, bool& Overflowed)
+{
+    //The same wrapped around sum as A + B, Overflowed says whether it did wrap
+    ID Sum {0};
+    Overflowed |= __builtin_add_overflow(A, B, &Sum);
+
+    return Sum;
+}
+
+
+template<typename ID>
+ID MultiplyChecked(ID A, ID B, bool& Overflowed)
+{
+    ID Product {0};
+    Overflowed |= __builtin_mul_overflow(A, B, &Product);
+
+    return Product;
+}
+
+
+template<typename ID>
+ID SumRepeatedBlocks(ID First, ID Last, int Digits, int BlockDigits, bool& Overflowed)
+{
+    //Sum of the IDs in [First, Last], all of them Digits long, that are a single block of BlockDigits digits repeated
+    //Such an ID is Block * Repunit, with Repunit a 1 every BlockDigits digits: 1001 for 3 digit blocks in 6 digit IDs
+    ID Repunit {0};
+    for(int i_Block {0}; i_Block < Digits / BlockDigits; ++i_Block){Repunit = Repunit * PowerOfTen<ID>(BlockDigits) + 1;}
+
+    //Blocks never start on a 0, the caller keeps First and Last to Digits digit IDs so that is already the case here
+    ID FirstBlock {std::max(PowerOfTen<ID>(BlockDigits - 1), First / Repunit + (First % Repunit != 0))};
+    ID LastBlock {std::min(PowerOfTen<ID>(BlockDigits) - 1, Last / Repunit)};
+    if(FirstBlock > LastBlock){return 0;}
+
+    //Arithmetic series of the blocks. 64 bit IDs have a wider type to do it in, 128 bit ones halve whichever factor is
+    //even instead (an odd count of blocks has a first and last block of the same parity), so nothing overflows before
+    //the products that can actually go past the width of an ID
+    ID Blocks {LastBlock - FirstBlock + 1};
+    ID BlockSum {0};
+    if constexpr(sizeof(ID) < sizeof(unsigned __int128))
+    {
+        BlockSum = (ID)(((unsigned __int128)FirstBlock + LastBlock) * Blocks / 2);
+    }
+    else
+    {
+        bool OddBlocks {(bool)(Blocks % 2)};
+        ID EvenFactor {OddBlocks ? FirstBlock + LastBlock : Blocks};
+        ID OtherFactor {OddBlocks ? Blocks : FirstBlock + LastBlock};
+        BlockSum = MultiplyChecked(EvenFactor / 2, OtherFactor, Overflowed);
+    }
+
+    return MultiplyChecked(BlockSum, Repunit, Overflowed);
+}
+
+
+template<typename ID>
+ID SumInvalidIDsOne(ID First, ID Last, int Digits, bool& Overflowed)
+{
+    //Invalid for Problem 1 is a block repeated exactly twice
+    if(Digits % 2){return 0;}
+
+    return SumRepeatedBlocks(First, Last, Digits, Digits / 2, Overflowed);
+}
+
+
+template<typename ID>
+ID SumInvalidIDsTwo(ID First, ID Last, int Digits, bool& Overflowed)
+{
+    //Invalid for Problem 2 is any block repeated at least twice, 111111 is 1, 11 and 111 repeated, but counts once
+    //ShortestBlock[X] only holds the IDs whose shortest repeating block is X digits: every ID repeating BlockDigits
+    //digits has a shortest block that divides BlockDigits, so take off what the shorter divisors already have
+    ID ShortestBlock[MaxIDDigits<ID> + 1] {};
+    ID SumInvalidIDs {0};
+
+    for(int BlockDigits {1}; BlockDigits < Digits; ++BlockDigits)
+    {
+        if(Digits % BlockDigits){continue;}
+
+        //The shorter blocks only take off IDs that are in this sum too, so the subtraction never wraps around
+        ShortestBlock[BlockDigits] = SumRepeatedBlocks(First, Last, Digits, BlockDigits, Overflowed);
+        for(int Shorter {1}; Shorter < BlockDigits; ++Shorter)
+        {
+            if(!(BlockDigits % Shorter)){ShortestBlock[BlockDigits] -= ShortestBlock[Shorter];}
+        }
+
+        SumInvalidIDs = AddChecked(SumInvalidIDs, ShortestBlock[BlockDigits], Overflowed);
+    }
+
+    return SumInvalidIDs;
+}
+
+
+template<typename ID>
+std::pmr::vector<IDRange<ID>>* GetMergedRanges(InputLines* p_VectorOfRangePairs, RunArena& Arena)
+{
+    //Sorted ranges that do not overlap, so every ID is only looked at once
+    std::pmr::vector<IDRange<ID>>* p_Ranges = Arena.Create<std::pmr::vector<IDRange<ID>>>(&Arena);
+    p_Ranges->reserve(p_VectorOfRangePairs->size());
+
+    for(std::string_view IntPairString : *p_VectorOfRangePairs)
+    {
+        IDRange<ID> Range {};
+        if(!NumberParsing::ParseRange(IntPairString, Range.First, Range.Last)){continue;}
+        p_Ranges->emplace_back(Range);
+    }
+
+    //Same as the reference's map, a range starting where an earlier one starts replaces it
+    std::stable_sort(p_Ranges->begin(), p_Ranges->end(), [](const IDRange<ID>& A, const IDRange<ID>& B){return A.First < B.First;});
+
+    int Kept {0};
+    for(int i_Range {0}; i_Range < (int)p_Ranges->size(); ++i_Range)
+    {
+        bool Replaced {i_Range + 1 < (int)p_Ranges->size() && (*p_Ranges)[i_Range + 1].First == (*p_Ranges)[i_Range].First};
+        if(!Replaced){(*p_Ranges)[Kept++] = (*p_Ranges)[i_Range];}
+    }
+    p_Ranges->resize(Kept);
+
+    MergeSortedRanges(*p_Ranges);
+
+    return p_Ranges;
+}
+
+
+template<typename ID>
+void SumInvalidIDsByDigits(std::pmr::vector<IDRange<ID>>& Ranges, ID& SumOne, ID& SumTwo, bool& OverflowOne, bool& OverflowTwo)
+{
+    //Sums wrap around at the width of an ID, so the 64 bit answers come out the same as the reference's
+    //The overflow flags say whether they did, so the 128 bit answers are either exact or not given at all
+    for(IDRange<ID>& Range : Ranges)
+    {
+        //Split the range up by digit count, the shape of an invalid ID depends on how many digits it has
+        for(int Digits {CountDigits(Range.First)}; Digits <= CountDigits(Range.Last); ++Digits)
+        {
+            ID SmallestID {PowerOfTen<ID>(Digits - 1)};
+            ID LargestID {Digits == MaxIDDigits<ID> ? ~ID {0} : PowerOfTen<ID>(Digits) - 1};
+            ID First {std::max(Range.First, SmallestID)};
+            ID Last {std::min(Range.Last, LargestID)};
+
+            SumOne = AddChecked(SumOne, SumInvalidIDsOne(First, Last, Digits, OverflowOne), OverflowOne);
+            SumTwo = AddChecked(SumTwo, SumInvalidIDsTwo(First, Last, Digits, OverflowTwo), OverflowTwo);
+        }
+    }
+}
+
+
+struct FastInput
+{
+    //IDs up to 19 digits always fit in 64 bits, longer ones go in 128 bits, only one of the two is filled in
+    std::pmr::vector<IDRange<std::uint64_t>>* p_Ranges {nullptr};
+    std::pmr::vector<IDRange<unsigned __int128>>* p_WideRanges {nullptr};
+    bool Solved {false};
+
+    std::string SumInvalidIDsOne {};
+    std::string SumInvalidIDsTwo {};
+};
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    FastInput* p_Parsed = Options.p_Arena->Create<FastInput>();
+
+    int MaxDigits {GetMaxIDDigits(p_InputDataVector)};
+    if(MaxDigits < MaxIDDigits<std::uint64_t>)
+    {
+        p_Parsed->p_Ranges = GetMergedRanges<std::uint64_t>(p_InputDataVector, *Options.p_Arena);
+    }
+    else if(IDsFitIn128Bits(MaxDigits))
+    {
+        p_Parsed->p_WideRanges = GetMergedRanges<unsigned __int128>(p_InputDataVector, *Options.p_Arena);
+    }
+
+    return p_Parsed;
+}
+
+
+void FastSolveBothProblems(RunOptions& Options, FastInput* p_Parsed)
+{
+    TraceSpan Span {"FastSolveBothProblems"};
+
+    if(p_Parsed->p_Ranges)
+    {
+        std::uint64_t SumOne {0};
+        std::uint64_t SumTwo {0};
+        bool OverflowOne {false};
+        bool OverflowTwo {false};
+        SumInvalidIDsByDigits(*p_Parsed->p_Ranges, SumOne, SumTwo, OverflowOne, OverflowTwo);
+
+        p_Parsed->SumInvalidIDsOne = std::to_string(SumOne);
+        p_Parsed->SumInvalidIDsTwo = std::to_string(SumTwo);
+    }
+    else if(p_Parsed->p_WideRanges)
+    {
+        unsigned __int128 SumOne {0};
+        unsigned __int128 SumTwo {0};
+        bool OverflowOne {false};
+        bool OverflowTwo {false};
+        SumInvalidIDsByDigits(*p_Parsed->p_WideRanges, SumOne, SumTwo, OverflowOne, OverflowTwo);
+
+        //Nothing wider to fall back on, a sum past 128 bits is reported instead of being answered wrapped around
+        if(OverflowOne || OverflowTwo){std::cout << "The sum of the invalid IDs does not fit in 128 bits" << std::endl;}
+        if(!OverflowOne){p_Parsed->SumInvalidIDsOne = WideIDToString(SumOne);}
+        if(!OverflowTwo){p_Parsed->SumInvalidIDsTwo = WideIDToString(SumTwo);}
+    }
+
+    p_Parsed->Solved = true;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return p_Parsed->SumInvalidIDsOne;
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return p_Parsed->SumInvalidIDsTwo;
+}
+
+} //namespace Day02
+
+
+//Hook this day into the shared runner
+//Version 2: the invalid IDs go up to the longest ID in any range, not just the one in the range that starts last
+//Version 3: IDs of 20 digits and up are summed in 128 bits instead of wrapping around 64
+//Version 4: part two candidates longer than the longest ID are skipped, they used to wrap around into the ranges
+//Version 5: 128 bit sums that go past 128 bits give no answer instead of a wrapped around one
+static bool Registered {RegisterDay<Day02::ParsedInput>(2, ',', Day02::ParseInput, Day02::AnswerProblemOne, Day02::AnswerProblemTwo, 1, 5)};
+static bool RegisteredFast {RegisterFastEngine<Day02::FastInput>(2, Day02::FastParseInput, Day02::FastAnswerProblemOne, Day02::FastAnswerProblemTwo)};
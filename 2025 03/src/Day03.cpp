@@ -0,0 +1,402 @@
+/*
+General approach for both problems:
+    Given an input for maximum number digit lenght (i.e. 4), start scanning number strings for the largest multiple of tens
+    working your way backwards to isolate the leftmost highest multiple
+    the 'leftmost' part is important, since this gives the most area remaining to look for smaller multiples
+
+    The sequence 6564327 with 4 digits as an example
+
+    find the largest 1000, 
+        scan [6564]327 (last three digits not relevant, since these cannot contain a full thousand)
+            largest leftmost digit is 6 at index 0
+    find largest 100, start at previous largest multiple's index + 1, since we do not want to count the same index twice 
+        scan 6[5643]27 (last two digits not relevant now, since these cannot contain a full hundred)
+            largest leftmost digit is 6 at index 2
+    find largest 10, again move the origin index by previous index + 1
+        scan 656[432]7 (last digit cannot contain a full ten)
+            largest leftmost digit is 4 at index 3
+    find largest 1
+        scan 6564[327]
+            largest leftmost digit is 7 at index 6
+
+    combining those all, it is clear that the largest possible number out of the sequence for 4 digits is 6647
+
+    The above can be done iteratively using a loop that starts with the needed 10eN, where N = (digits required - 1)
+    Summing up the Largest Multiple * 10eN for each iteration.
+
+Fast engine (--engine=fast):
+    The above rescans the window for every digit, so a bank of n batteries costs n * digits. The fast engine makes a
+    single pass instead, keeping the digits picked so far on a stack:
+
+        a battery higher than the top of the stack replaces it, as long as enough batteries are left to still fill
+        all the digits (Drops counts how many can be left out), then it goes on the stack if there is room
+
+    The stack only ever holds digits in non increasing order apart from where no drops are left, and every battery
+    is pushed and popped at most once, so a bank is O(n) for any number of digits. The number is built up with
+    integer multiply-adds instead of std::pow, so it stays exact up to MaxSelectedDigits
+
+    Both engines take every bank on its own length, a bank with fewer batteries than digits turns all of them on
+
+    SelectHighestDigits<Digits> fixes the digit count at compile time (2 and 12 for the puzzle), with a stack of just
+    that many digits, the plain overload takes it at runtime with a stack for MaxSelectedDigits, which is what
+    --queries=2,12,18 uses to answer any digit counts in one go
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day03
+{
+
+void FillBatteryArray(std::string_view BatteryString, int NumberOfBatteries, int* p_BatteryArray)
+{
+    //Turn the string of numbers into an array of ints
+    //The array is set aside once by the caller and refilled for every bank
+
+    for(int Index {0}; Index < NumberOfBatteries; ++Index)
+    {
+        //convert the char to an int by subtracting '0' ASCII magic
+        p_BatteryArray[Index] = BatteryString[Index] - '0';
+    }
+}
+
+
+long unsigned int GetHighestNumber(int* p_BatteryArray, int NumberOfBatteries, int NumberOfDigits)
+{
+    //Loop through each multiple of tens in descending order
+    //i.e. find the largest thousand first, then the largest hundred, largest ten, largest one
+
+    long unsigned int LargestNumber {0};
+
+    //A bank with fewer batteries than digits can only turn all of them on
+    NumberOfDigits = std::min(NumberOfDigits, NumberOfBatteries);
+
+    //This is to keeep track where the leftmost point in the number array is, which updates after finding 
+    //each largest 10eN (stops scanning to the left of the largest 10eN)
+    int i_LeftMostRoot {0};
+
+    //Start with the largest needed multiple, the power of 10 is the amount of needed digits - 1
+    //i.e. "2 digits" means highest 10e1 + highest 10e0
+    for(int PowerOfTen {NumberOfDigits - 1}; PowerOfTen >= 0; --PowerOfTen)
+    {
+        //Check the array from right to left, starting at the last number where a multiple can still occur
+        //no need to check for the largest 10e3 in ....321
+        
+        //Sum all 10eN..10e0 here
+        long unsigned int LargestMultiple   {0};
+
+        //Temp value to link back to i_LeftMostRoot
+        int i_LargestMultiple {0};
+
+        for(int i_IntArray {(NumberOfBatteries - 1) - PowerOfTen}; i_IntArray >= i_LeftMostRoot; --i_IntArray)
+        {
+            //Need to cast this as a long unsigned int to deal with the large numbers for problem 2
+            if((long unsigned int)p_BatteryArray[i_IntArray] >= LargestMultiple)
+            {
+                //Single out the leftmost largest multiple
+                LargestMultiple = p_BatteryArray[i_IntArray];
+                i_LargestMultiple = i_IntArray;
+            }
+        }
+
+        LargestNumber += (LargestMultiple * std::pow(10, PowerOfTen));
+        i_LeftMostRoot = i_LargestMultiple + 1;
+    }
+
+    return LargestNumber;
+}
+
+
+long unsigned int SolveProblemOne(int& Timed, InputLines* p_InputDataVector, int AmountOfDigits, RunArena& Arena)
+{
+    if(Timed){std::cout << "Starting Problem One:  ";PrintTimeNow();}
+
+    //Two digits per bank stay small, but enough banks add up past what an int holds
+    long unsigned int BatteryTotals {0};
+
+    //One array out of the run arena does for all of the banks, it only grows when a longer bank comes along
+    //Banks are all the same size in the puzzle, but every bank is read up to its own end, never past it
+    std::pmr::vector<int> BatteryArray(&Arena);
+
+    for(std::string_view Line : *p_InputDataVector)
+    {
+        int NumberOfBatteries {(int)Line.size()};
+        if((int)BatteryArray.size() < NumberOfBatteries){BatteryArray.resize(NumberOfBatteries);}
+
+        //Turn string into an array of ints
+        FillBatteryArray(Line, NumberOfBatteries, BatteryArray.data());
+
+        //Extract the largest number out of the currently checking array and sum it
+        BatteryTotals += GetHighestNumber(BatteryArray.data(), NumberOfBatteries, AmountOfDigits);
+    }
+
+    if(Timed){std::cout << "Ending Problem One:    ";PrintTimeNow();}
+
+    return BatteryTotals;
+}
+
+
+long unsigned int SolveProblemTwo(int& Timed, InputLines* p_InputDataVector, int AmountOfDigits, RunArena& Arena)
+{
+    //The same as SolveProblemOne, with those horrificly large numbers for every bank
+    if(Timed){std::cout << "Starting Problem Two:  ";PrintTimeNow();}
+
+    long unsigned int BatteryTotals {0};
+
+    std::pmr::vector<int> BatteryArray(&Arena);
+
+    for(std::string_view Line : *p_InputDataVector)
+    {
+        int NumberOfBatteries {(int)Line.size()};
+        if((int)BatteryArray.size() < NumberOfBatteries){BatteryArray.resize(NumberOfBatteries);}
+
+        FillBatteryArray(Line, NumberOfBatteries, BatteryArray.data());
+        BatteryTotals += GetHighestNumber(BatteryArray.data(), NumberOfBatteries, AmountOfDigits);
+    }
+
+    if(Timed){std::cout << "Ending Problem Two:    ";PrintTimeNow();}
+
+    return BatteryTotals;
+}
+
+
+struct ParsedInput
+{
+    //Both problems walk the raw battery banks
+    InputLines* p_InputDataVector {nullptr};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_InputDataVector, 2, *Options.p_Arena));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_InputDataVector, 12, *Options.p_Arena));
+}
+
+void StreamBothProblems(RunOptions& Options, LineStream& InputStream, std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //Every bank is maximised on its own, so both problems can be answered one line at a time as the input streams past
+
+    if(Options.Timed){std::cout << "Starting streamed Problem One and Two:  ";PrintTimeNow();}
+
+    long unsigned int BatteryTotalsOne {0};
+    long unsigned int BatteryTotalsTwo {0};
+
+    //Like the non streamed version, every bank is read up to its own end, the array grows with the longest one so far
+    std::vector<int> BatteryArray {};
+
+    std::string_view Line;
+    while(InputStream.NextLine(Line))
+    {
+        if(Line.empty()){continue;}
+
+        int NumberOfBatteries {(int)Line.size()};
+        if((int)BatteryArray.size() < NumberOfBatteries){BatteryArray.resize(NumberOfBatteries);}
+
+        FillBatteryArray(Line, NumberOfBatteries, BatteryArray.data());
+        BatteryTotalsOne += GetHighestNumber(BatteryArray.data(), NumberOfBatteries, 2);
+        BatteryTotalsTwo += GetHighestNumber(BatteryArray.data(), NumberOfBatteries, 12);
+    }
+
+    AnswerOne = std::to_string(BatteryTotalsOne);
+    AnswerTwo = std::to_string(BatteryTotalsTwo);
+
+    if(Options.Timed){std::cout << "Ending streamed Problem One and Two:    ";PrintTimeNow();}
+}
+
+constexpr int MaxSelectedDigits {19};    //Any 19 digit number fits in a long unsigned int
+
+
+template<int StackSize>
+long unsigned int SelectHighestDigitsOnStack(std::string_view Bank, int Digits)
+{
+    //Highest number made of Digits batteries out of the bank, keeping their order, in one pass
+    //Stack[0] is above any battery, so popping never has to check for an empty stack, StackSize covers the rest
+    char Stack[StackSize + 1];
+    Stack[0] = '9' + 1;
+    int Top {1};
+
+    //How many batteries can still be left out and leave enough to fill every digit
+    int Drops {(int)Bank.size() - Digits};
+
+    for(char Battery : Bank)
+    {
+        //A higher battery takes the place of the lower ones before it, while there are batteries to spare
+        while(Drops > 0 && Stack[Top - 1] < Battery)
+        {
+            --Top;
+            --Drops;
+        }
+
+        if(Top <= Digits){Stack[Top++] = Battery;}
+        else{--Drops;}
+    }
+
+    long unsigned int HighestNumber {0};
+    for(int i_Stack {1}; i_Stack < Top; ++i_Stack){HighestNumber = HighestNumber * 10 + (Stack[i_Stack] - '0');}
+
+    return HighestNumber;
+}
+
+
+inline long unsigned int SelectHighestDigits(std::string_view Bank, int Digits)
+{
+    //Any digit count up to MaxSelectedDigits, the stack is sized for the most there can be
+    return SelectHighestDigitsOnStack<MaxSelectedDigits>(Bank, Digits);
+}
+
+
+template<int Digits>
+long unsigned int SelectHighestDigits(std::string_view Bank)
+{
+    //The stack is exactly as deep as the digits, and with the count a constant the room check and the
+    //loop building the number up have fixed bounds
+    static_assert(Digits >= 1 && Digits <= MaxSelectedDigits, "Between 1 and MaxSelectedDigits digits fit a long unsigned int");
+
+    if constexpr(Digits == 2)
+    {
+        //Two digits need no stack: the best pair ending on each battery is the highest one before it, then this one
+        //Nothing but maxes, which turn into conditional moves, where the stack keeps guessing whether to pop
+        if(Bank.size() < 2){return SelectHighestDigitsOnStack<Digits>(Bank, Digits);}
+
+        int Highest {Bank[0] - '0'};
+        int HighestPair {0};
+        for(std::size_t i_Battery {1}; i_Battery < Bank.size(); ++i_Battery)
+        {
+            int Battery {Bank[i_Battery] - '0'};
+            HighestPair = std::max(HighestPair, Highest * 10 + Battery);
+            Highest = std::max(Highest, Battery);
+        }
+
+        return (long unsigned int)HighestPair;
+    }
+
+    return SelectHighestDigitsOnStack<Digits>(Bank, Digits);
+}
+
+
+struct FastInput
+{
+    InputLines* p_InputDataVector {nullptr};
+    bool Solved {false};
+
+    long unsigned int BatteryTotalsOne {0};
+    long unsigned int BatteryTotalsTwo {0};
+};
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    FastInput* p_Parsed = Options.p_Arena->Create<FastInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+void FastSolveBothProblems(RunOptions& Options, FastInput* p_Parsed)
+{
+    TraceSpan Span {"FastSolveBothProblems"};
+
+    //Straight off the lines, no int array to fill first
+    for(std::string_view Line : *p_Parsed->p_InputDataVector)
+    {
+        p_Parsed->BatteryTotalsOne += SelectHighestDigits<2>(Line);
+        p_Parsed->BatteryTotalsTwo += SelectHighestDigits<12>(Line);
+    }
+
+    p_Parsed->Solved = true;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->BatteryTotalsOne);
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Solved){FastSolveBothProblems(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->BatteryTotalsTwo);
+}
+
+
+bool AnswerQueries(RunOptions& Options, InputLines* p_InputDataVector, std::vector<std::string>& Answers)
+{
+    //Every query is a number of batteries to turn on per bank, the puzzle asks for 2 and 12
+    std::vector<int> Queries {};
+    if(!NumberParsing::ParseList(Options.Queries, Queries))
+    {
+        std::cout << "Bad battery query: " << Options.Queries << ", expected digit counts like 2,12" << std::endl;
+        return false;
+    }
+
+    for(int Digits : Queries)
+    {
+        if(Digits < 1 || Digits > MaxSelectedDigits)
+        {
+            std::cout << "Bad battery query: " << Digits << ", a bank can turn on 1 to " << MaxSelectedDigits << " batteries" << std::endl;
+            return false;
+        }
+    }
+
+    //The whole input is the only line, go through the banks once and answer every query for each of them
+    std::vector<long unsigned int> BatteryTotals(Queries.size(), 0);
+    std::string_view Banks {(*p_InputDataVector)[0]};
+    while(!Banks.empty())
+    {
+        std::size_t Newline {std::min(Banks.find('\n'), Banks.size())};
+        std::string_view Bank {Banks.substr(0, Newline)};
+        Banks.remove_prefix(std::min(Newline + 1, Banks.size()));
+        if(Bank.empty()){continue;}
+
+        for(int i_Query {0}; i_Query < (int)Queries.size(); ++i_Query){BatteryTotals[i_Query] += SelectHighestDigits(Bank, Queries[i_Query]);}
+    }
+
+    for(int i_Query {0}; i_Query < (int)Queries.size(); ++i_Query)
+    {
+        Answers.emplace_back(std::to_string(Queries[i_Query]) + " digits: " + std::to_string(BatteryTotals[i_Query]));
+    }
+
+    return true;
+}
+
+} //namespace Day03
+
+
+//Hook this day into the shared runner
+//Version 2: every bank on its own length, the reference used to take the first bank's length for all of them
+static bool Registered {RegisterDay<Day03::ParsedInput>(3, '\n', Day03::ParseInput, Day03::AnswerProblemOne, Day03::AnswerProblemTwo, 1, 2)};
+static bool RegisteredStream {RegisterStreamingDay(3, Day03::StreamBothProblems)};
+static bool RegisteredFast {RegisterFastEngine<Day03::FastInput>(3, Day03::FastParseInput, Day03::FastAnswerProblemOne, Day03::FastAnswerProblemTwo)};
+static bool RegisteredQuery {RegisterQueryDay(3, Day03::AnswerQueries)};
@@ -0,0 +1,360 @@
+/*
+Problem 1 approach:
+    Scan the grid using a double for loop 
+        for(Line in Grid)
+        {
+            for(Location in Line)
+            {
+                if(Grid[Line][Location] == '@')
+                    //do something
+            }
+        }
+    This will look at each YX coordinate in the Grid that contains a @
+
+    This YX coordinate can then be used to generate 8 surrounding YX coordinates by 
+    using different combinations of subtracting and adding from and to either, or both, the Y and X coordinate
+    [Y-1][X-1] will, for example, look at a coordinate to the topleft of YX
+
+    Each of these coordinate points can be looked up in the Grid to see if they contain a @ char and a tally can be
+    kept about whether or not they do. If this tally goes over 3, we discard the current coordinate and move on.
+
+    for(YX in Grid)
+    {
+        SurroundingLocations = GetSurroundingLocations(YX)
+
+        if(ContainsLessThanThree)
+        {
+            Add YX location to a vector
+            in main, just get the size of this vector
+        }
+    }
+
+    where: 
+
+    ContainsLessThanThree()
+    {
+        Tally = 0
+
+        for(Neighbour in SurroundingLocations)
+        {
+            if(Neighbour == @)
+            {
+                ++Tally;
+            }
+
+            if(Tally > 3)
+            {
+                return false
+            }
+        }
+
+        return true
+    }
+
+    This leaves a vector of all removeable rolls' YX location, which can then just be .size()'d
+    to get a total amount of rolls and sets up for problem 2.
+
+Problem 2 approach:
+
+    Use the GetClearRollLocations function to snag a list of all currently available rolls
+    Tally the rolls
+    Remove them from the grid
+    Rinse and repeat while GetClearRolls not yet returns 0
+
+    As soon as GetClearRolls returns 0, all possible rolls have been removed
+
+Fast engine (--engine=fast):
+    The above stays as the reference. The fast engine copies the grid into one flat array of bytes with an empty
+    border around it, so no neighbour needs bounds checking, and counts the neighbouring rolls of every cell once
+
+    Problem 1 is then a count of the rolls with fewer than 4 neighbours
+
+    For problem 2 the order rolls are taken away in does not change which ones end up removed, so instead of
+    rescanning the grid every round, removing a roll lowers the count of its neighbours and any neighbour that drops
+    to 3 goes on a stack to be removed in turn. Every roll is looked at a fixed number of times
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory_resource>
+#include <cstdint>
+
+#include "InputLoader.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+
+
+namespace Day04
+{
+
+struct RollLocation
+{
+    int Y {0};
+    int X {0};
+};
+
+
+bool LocationIsOpen(int OriginY, int OriginX, int LenY, int LenX, std::pmr::vector<std::pmr::string>* p_InputDataVector)
+{
+    //Take an origin location and cycle through its neighbours (if possible)
+    //Keep a running total of nearby rolls, if this ever exceeds 3 exit early
+
+    int NeighbouringRolls {0};
+
+    //Locate all neighbours by looping through Y, looping through X coordinates
+    for(int OffsetY {OriginY - 1}; (OffsetY <= OriginY + 1); ++OffsetY)
+    {
+        //Bounds checking for Y
+        if(OffsetY >= 0 && OffsetY < LenY)
+        {
+            for(int OffsetX {OriginX - 1}; (OffsetX <= OriginX + 1); ++OffsetX)
+            {
+                //Bounds checking for X
+                if(OffsetX >= 0 && OffsetX < LenX)
+                {
+                    //Filter out the location of the roll itself (Y, X = OffsetY, OffsetX)
+                    if(!((OriginY == OffsetY) && (OriginX == OffsetX)))
+                    {
+                        //If a neighbour is a roll, tally it
+                        //If the total amount of neighbouring rolls exceeds 3, stop counting and return 
+                        //"Nope, this roll isn't free"
+                        if((*p_InputDataVector)[OffsetY][OffsetX] == '@')
+                        {
+                            ++NeighbouringRolls;
+
+                            if(NeighbouringRolls == 4)
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //Since the false condition hasn't triggered, this roll must be free
+    return true;  
+}
+
+
+void GetClearRollLocations(std::pmr::vector<std::pmr::string>* p_InputDataVector, std::pmr::vector<RollLocation>* p_VectorOfRemoveableYXLocations)
+{
+    //Essentially, just loop through YX coordinates, get its neighbours YX, then check its neighbours char in the grid
+    //if more than 3 neighbours are @, exit early
+    //if not, track that YX coordinate
+    //The vector is handed in and only cleared, so Problem 2 keeps reusing the same memory every round
+    p_VectorOfRemoveableYXLocations->clear();
+
+    //Setting up some size data
+    int LenY = (*p_InputDataVector).size();
+    int LenX = (*p_InputDataVector)[0].size();
+
+    //Look at each YX coordinate
+    for(int Y {0}; Y < LenY; ++Y)
+    {
+        for(int X {0}; X < LenX; ++X)
+        {
+            //Only test coordinates with rolls in 'em
+            if((*p_InputDataVector)[Y][X] == '@')
+            {
+                if(LocationIsOpen(Y, X, LenY, LenX, p_InputDataVector))
+                {
+                    p_VectorOfRemoveableYXLocations->emplace_back(RollLocation {Y, X});
+                }
+            }
+        }
+    }
+}
+
+
+int SolveProblemOne(int& Timed, std::pmr::vector<std::pmr::string>* p_InputDataVector, RunArena& Arena)
+{
+    if(Timed){std::cout << "Starting Problem One:  ";PrintTimeNow();}
+
+    int TotalAccesibleRolls {0};
+
+    //Get a vector of all roll coordinates that can be removed
+    std::pmr::vector<RollLocation>* p_VectorOfRemoveables = Arena.Create<std::pmr::vector<RollLocation>>(&Arena);
+    GetClearRollLocations(p_InputDataVector, p_VectorOfRemoveables);
+
+    //Then just grab the size of that vector
+    TotalAccesibleRolls = p_VectorOfRemoveables->size();
+
+    if(Timed){std::cout << "Ending Problem One:    ";PrintTimeNow();}
+
+    return TotalAccesibleRolls;
+}
+
+
+int SolveProblemTwo(int& Timed, std::pmr::vector<std::pmr::string>* p_InputDataVector, RunArena& Arena)
+{
+    if(Timed){std::cout << "Starting Problem Two:  ";PrintTimeNow();}
+
+    //Summing all removed rolls here
+    int TotalRemoved {0};
+
+    //Grab all currently available rolls
+    std::pmr::vector<RollLocation>* p_VectorOfRemoveables = Arena.Create<std::pmr::vector<RollLocation>>(&Arena);
+    GetClearRollLocations(p_InputDataVector, p_VectorOfRemoveables);
+
+    //While you can still remove rolls
+    while(p_VectorOfRemoveables->size() != 0)
+    {   
+        //Tally the removable ones
+        TotalRemoved += p_VectorOfRemoveables->size();
+
+        //Remove all rolls that can be removed
+        for(RollLocation YX : *p_VectorOfRemoveables)
+        {
+            (*p_InputDataVector)[YX.Y][YX.X] = '.';
+        }
+
+        //Look for newly removeable rolls
+        GetClearRollLocations(p_InputDataVector, p_VectorOfRemoveables);
+    }
+
+    if(Timed){std::cout << "Ending Problem Two:    ";PrintTimeNow();}
+
+    return TotalRemoved;
+}
+
+
+struct ParsedInput
+{
+    //Problem 2 removes rolls from the grid, the mapped input is read-only so this is a writeable copy of the grid
+    //Both the rows and the vector holding them live in the run arena
+    std::pmr::vector<std::pmr::string>* p_GridVector {nullptr};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ParsedInput* p_Parsed = Arena.Create<ParsedInput>();
+
+    //The pmr vector hands the arena on to every row it constructs
+    p_Parsed->p_GridVector = Arena.Create<std::pmr::vector<std::pmr::string>>(&Arena);
+    p_Parsed->p_GridVector->reserve(p_InputDataVector->size());
+    for(std::string_view Line : *p_InputDataVector){p_Parsed->p_GridVector->emplace_back(Line);}
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_GridVector, *Options.p_Arena));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    //Problem 2 is just Problem 1, but remove known accesible locations each iteration
+    //during a while loop until none can be removed any longer
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_GridVector, *Options.p_Arena));
+}
+
+
+struct FastInput
+{
+    //Rows of Width cells with one empty cell (and one empty row) on every side, 1 for a roll
+    int Width {0};
+    int Height {0};
+    std::pmr::vector<std::uint8_t>* p_Rolls {nullptr};
+    std::pmr::vector<std::uint8_t>* p_NeighbourCounts {nullptr};
+};
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    FastInput* p_Parsed = Arena.Create<FastInput>();
+
+    int LenY = p_InputDataVector->size();
+    int LenX = LenY ? (*p_InputDataVector)[0].size() : 0;
+    p_Parsed->Width = LenX + 2;
+    p_Parsed->Height = LenY + 2;
+
+    std::size_t Cells {(std::size_t)p_Parsed->Width * p_Parsed->Height};
+    p_Parsed->p_Rolls = Arena.Create<std::pmr::vector<std::uint8_t>>(Cells, 0, &Arena);
+    p_Parsed->p_NeighbourCounts = Arena.Create<std::pmr::vector<std::uint8_t>>(Cells, 0, &Arena);
+
+    std::uint8_t* p_Rolls {p_Parsed->p_Rolls->data()};
+    for(int Y {0}; Y < LenY; ++Y)
+    {
+        std::string_view Line {(*p_InputDataVector)[Y]};
+        std::uint8_t* p_Row {p_Rolls + (std::size_t)(Y + 1) * p_Parsed->Width + 1};
+        for(int X {0}; X < std::min(LenX, (int)Line.size()); ++X){p_Row[X] = Line[X] == '@';}
+    }
+
+    //Every neighbour is a fixed offset away thanks to the border, so this loop has no branches to speak of
+    std::uint8_t* p_Counts {p_Parsed->p_NeighbourCounts->data()};
+    int Width {p_Parsed->Width};
+    for(std::size_t Cell {(std::size_t)Width + 1}; Cell + Width + 1 < Cells; ++Cell)
+    {
+        p_Counts[Cell] = p_Rolls[Cell - Width - 1] + p_Rolls[Cell - Width] + p_Rolls[Cell - Width + 1]
+                       + p_Rolls[Cell - 1]                                  + p_Rolls[Cell + 1]
+                       + p_Rolls[Cell + Width - 1] + p_Rolls[Cell + Width] + p_Rolls[Cell + Width + 1];
+    }
+
+    return p_Parsed;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    const std::uint8_t* p_Rolls {p_Parsed->p_Rolls->data()};
+    const std::uint8_t* p_Counts {p_Parsed->p_NeighbourCounts->data()};
+
+    int TotalAccesibleRolls {0};
+    for(std::size_t Cell {0}; Cell < p_Parsed->p_Rolls->size(); ++Cell){TotalAccesibleRolls += p_Rolls[Cell] & (p_Counts[Cell] < 4);}
+
+    return std::to_string(TotalAccesibleRolls);
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    //Works on copies, problem 1 may still want the grid as it was
+    RunArena& Arena {*Options.p_Arena};
+    std::pmr::vector<std::uint8_t> Rolls(*p_Parsed->p_Rolls, &Arena);
+    std::pmr::vector<std::uint8_t> Counts(*p_Parsed->p_NeighbourCounts, &Arena);
+    std::pmr::vector<std::uint32_t> Removable(&Arena);
+
+    int Width {p_Parsed->Width};
+    const int Offsets[8] {-Width - 1, -Width, -Width + 1, -1, 1, Width - 1, Width, Width + 1};
+
+    for(std::size_t Cell {0}; Cell < Rolls.size(); ++Cell)
+    {
+        if(Rolls[Cell] && Counts[Cell] < 4){Removable.emplace_back((std::uint32_t)Cell);}
+    }
+
+    //A roll goes on the stack once, either from the start or when its count drops from 4 to 3
+    int TotalRemoved {0};
+    while(!Removable.empty())
+    {
+        std::uint32_t Cell {Removable.back()};
+        Removable.pop_back();
+
+        Rolls[Cell] = 0;
+        ++TotalRemoved;
+
+        for(int Offset : Offsets)
+        {
+            std::uint32_t Neighbour {Cell + Offset};
+            if(Rolls[Neighbour] && --Counts[Neighbour] == 3){Removable.emplace_back(Neighbour);}
+        }
+    }
+
+    return std::to_string(TotalRemoved);
+}
+
+} //namespace Day04
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day04::ParsedInput>(4, '\n', Day04::ParseInput, Day04::AnswerProblemOne, Day04::AnswerProblemTwo)};
+static bool RegisteredFast {RegisterFastEngine<Day04::FastInput>(4, Day04::FastParseInput, Day04::FastAnswerProblemOne, Day04::FastAnswerProblemTwo)};
@@ -0,0 +1,446 @@
+/*
+Problem 1 approach:
+    Similar to Day 2, construct a map of [int] = int to keep track of all ranges in an ordered way
+    Also, in a second (inefficient, but easy to implement) pass, isolate all ingredient IDs
+
+    Then start testing IDs to [key] and [value]
+        1. if ID < [key]:  pass
+        2. if ID >= [key]:  inspect
+            if ID > [key][value]: pass
+            if ID <= [key][value]: Tally this entry, as [key] <= ID <= [value] 
+                break out of loop, no longer need to check this ID
+
+Problem 2 approach:
+    The map already contains all the ranges in order, now we just need to figure out where the overlaps occur
+
+    Looping through each key, compare the keys and values between range n, following m:
+
+        By the ordered property of the list, n[key] > m[key]
+
+        1. if n[key] > m[value]           ->   This is the start of a new range, i.e. there is a gap between range m and range n
+        2. if n[key] <= m[value]          ->   The start of range n is partially in range m
+            a. if n[value] > m[value]     ->   The range of m is extended by the [value] of n
+            b. if n[value] <= m[value]    ->   range n is simply swallowed up by range m
+
+    By keeping track of the terminal ends of each range it becomes possible to collapse all ranges down into a linear collection of separate ranges
+
+    The size of these ranges can then be tallied for a final answer
+
+Fast engine (--engine=fast):
+    The above stays as the reference. The fast engine keeps the ranges in a flat array instead of a map, sorts it once
+    and collapses it straight away, exactly as problem 2 does
+
+    With the ranges collapsed, an ID is fresh if it falls in the last collapsed range starting at or below it, so every
+    ID costs a binary search instead of a walk over all ranges, and problem 2 is a sum over the collapsed ranges
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory_resource>
+#include <algorithm>
+
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "CompiledInput.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+
+
+namespace Day05
+{
+
+void AddRangeToMap(std::string_view Line, std::pmr::map<long unsigned int, long unsigned int>* p_RangeMap)
+{
+    //Isolate the two numerical values
+    long unsigned int HoldInts[2] {0, 0};
+    if(!NumberParsing::ParseRange(Line, HoldInts[0], HoldInts[1])){return;}
+
+    //store [max] value under [min] key
+    //The input has some keys that are identical, we need to account for that
+    if(p_RangeMap->find(HoldInts[0]) != p_RangeMap->end())
+    {
+        //This checks if an already listed value is larger than the listed value and stores it if so
+        if((*p_RangeMap)[HoldInts[0]] < HoldInts[1])
+        {
+            (*p_RangeMap)[HoldInts[0]] = HoldInts[1];
+        }
+    }
+    else
+    {
+        //Otherwise, just add the new [key]:[value] pair
+        (*p_RangeMap)[HoldInts[0]] = HoldInts[1];
+    }
+}
+
+
+std::pmr::map<long unsigned int, long unsigned int>* GetRangesAsMap(InputLines* p_InputDataVector, RunArena& Arena)
+{
+    //Iterate through all lines in the input file and isolate only the ranges
+    //Store these in a map of [min] = max
+
+    std::pmr::map<long unsigned int, long unsigned int>* p_RangeMap = Arena.Create<std::pmr::map<long unsigned int, long unsigned int>>(&Arena);
+
+    for(std::string_view Line : *p_InputDataVector)
+    {
+        //Exits early when the linebreak separating the ranges from the inputs is detected
+        if(Line.size())
+        {
+            AddRangeToMap(Line, p_RangeMap);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return p_RangeMap;
+}
+
+
+std::pmr::vector<long unsigned int>* GetIngredientIDs(InputLines* p_InputDataVector, RunArena& Arena)
+{
+    //Second pass of the input file, which is inefficient, but less hassle
+
+    std::pmr::vector<long unsigned int>* p_IngredientIDs = Arena.Create<std::pmr::vector<long unsigned int>>(&Arena);
+
+    //Do not read in any data until the line break has occured
+    bool StartReading {false};
+
+    for(std::string_view Line : *p_InputDataVector)
+    {   
+        if(StartReading)
+        {
+            p_IngredientIDs->emplace_back(NumberParsing::ToUnsigned<long unsigned int>(Line));
+        }
+        if(!Line.size())
+        {
+            StartReading = true;
+        }
+    }
+
+    return p_IngredientIDs;
+}
+
+
+bool IngredientIsFresh(long unsigned int IngredientID, std::pmr::map<long unsigned int, long unsigned int>* p_RangesMap)
+{
+    //Check each range
+    for(auto Range : *p_RangesMap)
+    {
+        //If the ingredient fits the range, exit early
+        if(IngredientID >= Range.first && IngredientID <= Range.second)
+        {
+            return true;
+        } 
+    }
+
+    return false;
+}
+
+
+int SolveProblemOne(int& Timed, std::pmr::map<long unsigned int, long unsigned int>* p_RangesMap, std::pmr::vector<long unsigned int>* p_VectorOfIngredients)
+{  
+    if(Timed){std::cout << "Starting Problem One:  ";PrintTimeNow();}
+
+    int Tally {0};
+
+    //Go through each ingredient ID
+    for(long unsigned int IngredientID : *p_VectorOfIngredients)
+    {
+        if(IngredientIsFresh(IngredientID, p_RangesMap)){++Tally;}
+    }
+
+    if(Timed){std::cout << "Ending Problem One:    ";PrintTimeNow();}
+
+    return Tally;
+}
+
+
+long unsigned int SolveProblemTwo(int& Timed, std::pmr::map<long unsigned int, long unsigned int>* p_RangesMap)
+{  
+    if(Timed){std::cout << "Starting Problem Two:  ";PrintTimeNow();}
+
+    long unsigned int Tally {0};
+
+    //Collapse the ranges and store them here, in the same place as the ranges themselves
+    std::pmr::map<long unsigned int, long unsigned int> CollapsedRanges(p_RangesMap->get_allocator());
+
+    long unsigned int LastMinimum {0};
+    long unsigned int LastMaximum {0};
+
+    //Cut down the ranges in the ranges map
+    for(auto Range : *p_RangesMap)
+    {
+        //Check if this is the start of a new range
+        if(Range.first > LastMaximum)
+        {
+            CollapsedRanges[Range.first] = Range.second;
+            LastMinimum = Range.first;
+            LastMaximum = Range.second;
+        }
+        //the miminum of this range is within the last range
+        else
+        {
+            //Check if this extends the range
+            if(Range.second > LastMaximum)
+            {
+                CollapsedRanges[LastMinimum] = Range.second;
+                LastMaximum = Range.second;
+            }
+        }
+    }
+
+    //With ranges properly collapsed, just get the size of each gap and tally them
+    for(auto Range : CollapsedRanges)
+    {
+        //Remember that the ranges are >inclusive<, therefore add a +1
+        Tally += (Range.second - Range.first + 1);
+    }
+
+    if(Timed){std::cout << "Ending Problem Two:    ";PrintTimeNow();}
+    
+    return Tally;
+}
+
+
+struct ParsedInput
+{
+    //The ranges and ingredient IDs, in the run arena, which cleans up after the runner is done with them
+    std::pmr::map<long unsigned int, long unsigned int>* p_RangesMap {nullptr};
+    std::pmr::vector<long unsigned int>* p_VectorOfIngredients {nullptr};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ParsedInput* p_Parsed = Arena.Create<ParsedInput>();
+
+    //Isolate all ranges from the vector and keep them in a map
+    //Some range minimums appear multiple times in the input file, KEEP THAT IN MIND
+    p_Parsed->p_RangesMap = GetRangesAsMap(p_InputDataVector, Arena);
+
+    //Isolate all ingredient IDs
+    p_Parsed->p_VectorOfIngredients = GetIngredientIDs(p_InputDataVector, Arena);
+
+    return p_Parsed;
+}
+
+
+void CompileInput(ParsedInput* p_Parsed, CompiledWriter& Writer)
+{
+    //The ranges as flat {min, max} pairs in map order, then the ingredient IDs as they are
+    std::vector<long unsigned int> FlatRanges {};
+    FlatRanges.reserve(p_Parsed->p_RangesMap->size() * 2);
+    for(auto Range : *p_Parsed->p_RangesMap)
+    {
+        FlatRanges.emplace_back(Range.first);
+        FlatRanges.emplace_back(Range.second);
+    }
+
+    Writer.PutArray(FlatRanges.data(), FlatRanges.size());
+    Writer.PutArray(p_Parsed->p_VectorOfIngredients->data(), p_Parsed->p_VectorOfIngredients->size());
+}
+
+
+ParsedInput* ReloadInput(RunOptions& Options, CompiledReader& Reader)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ParsedInput* p_Parsed = Arena.Create<ParsedInput>();
+
+    std::size_t RangeValues {0};
+    const long unsigned int* p_Ranges {Reader.GetArray<long unsigned int>(RangeValues)};
+    std::size_t IngredientCount {0};
+    const long unsigned int* p_Ingredients {Reader.GetArray<long unsigned int>(IngredientCount)};
+
+    //The pairs are already in key order, so every insert can go straight to the end of the map
+    p_Parsed->p_RangesMap = Arena.Create<std::pmr::map<long unsigned int, long unsigned int>>(&Arena);
+    for(std::size_t i_Value {0}; i_Value + 1 < RangeValues; i_Value += 2)
+    {
+        p_Parsed->p_RangesMap->emplace_hint(p_Parsed->p_RangesMap->end(), p_Ranges[i_Value], p_Ranges[i_Value + 1]);
+    }
+
+    p_Parsed->p_VectorOfIngredients = Arena.Create<std::pmr::vector<long unsigned int>>(p_Ingredients, p_Ingredients + IngredientCount, &Arena);
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_RangesMap, p_Parsed->p_VectorOfIngredients));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_RangesMap));
+}
+
+void StreamBothProblems(RunOptions& Options, LineStream& InputStream, std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //The ranges have to be known in full, but after the blank line every ingredient ID can be checked and forgotten
+    //straight away, memory use is bound by the amount of ranges rather than the amount of IDs
+
+    if(Options.Timed){std::cout << "Starting streamed Problem One:  ";PrintTimeNow();}
+
+    //There is no run arena when streaming, a local one does the same job
+    RunArena Arena {};
+    std::pmr::map<long unsigned int, long unsigned int>* p_RangesMap = Arena.Create<std::pmr::map<long unsigned int, long unsigned int>>(&Arena);
+    bool ReadingRanges {true};
+    long unsigned int Tally {0};
+
+    std::string_view Line;
+    while(InputStream.NextLine(Line))
+    {
+        if(!Line.size())
+        {
+            ReadingRanges = false;
+        }
+        else if(ReadingRanges)
+        {
+            AddRangeToMap(Line, p_RangesMap);
+        }
+        else if(IngredientIsFresh(NumberParsing::ToUnsigned<long unsigned int>(Line), p_RangesMap))
+        {
+            ++Tally;
+        }
+    }
+
+    if(Options.Timed){std::cout << "Ending streamed Problem One:    ";PrintTimeNow();}
+
+    AnswerOne = std::to_string(Tally);
+    AnswerTwo = std::to_string(SolveProblemTwo(Options.Timed, p_RangesMap));
+
+    //Cleaning up, the map goes with the arena
+    p_RangesMap = nullptr;
+}
+
+
+struct FreshRange
+{
+    long unsigned int Minimum {0};
+    long unsigned int Maximum {0};
+};
+
+
+struct FastInput
+{
+    //Collapsed ranges, sorted and without any overlap, and the ingredient IDs, all in the run arena
+    std::pmr::vector<FreshRange>* p_Ranges {nullptr};
+    std::pmr::vector<long unsigned int>* p_VectorOfIngredients {nullptr};
+};
+
+
+void CollapseRanges(std::pmr::vector<FreshRange>* p_Ranges)
+{
+    //Same rule as problem 2 of the reference: a range only starts a new one if it begins past the end of the last
+    std::sort(p_Ranges->begin(), p_Ranges->end(), [](const FreshRange& A, const FreshRange& B){return A.Minimum < B.Minimum;});
+
+    std::size_t Collapsed {0};
+    for(FreshRange& Range : *p_Ranges)
+    {
+        if(Collapsed && Range.Minimum <= (*p_Ranges)[Collapsed - 1].Maximum)
+        {
+            (*p_Ranges)[Collapsed - 1].Maximum = std::max((*p_Ranges)[Collapsed - 1].Maximum, Range.Maximum);
+        }
+        else
+        {
+            (*p_Ranges)[Collapsed++] = Range;
+        }
+    }
+    p_Ranges->resize(Collapsed);
+}
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    FastInput* p_Parsed = Arena.Create<FastInput>();
+    p_Parsed->p_Ranges = Arena.Create<std::pmr::vector<FreshRange>>(&Arena);
+    p_Parsed->p_VectorOfIngredients = Arena.Create<std::pmr::vector<long unsigned int>>(&Arena);
+
+    //One pass, ranges up to the blank line, IDs after it
+    bool ReadingRanges {true};
+    for(std::string_view Line : *p_InputDataVector)
+    {
+        if(!Line.size())
+        {
+            ReadingRanges = false;
+        }
+        else if(ReadingRanges)
+        {
+            FreshRange Range {};
+            if(NumberParsing::ParseRange(Line, Range.Minimum, Range.Maximum)){p_Parsed->p_Ranges->emplace_back(Range);}
+        }
+        else
+        {
+            p_Parsed->p_VectorOfIngredients->emplace_back(NumberParsing::ToUnsigned<long unsigned int>(Line));
+        }
+    }
+
+    CollapseRanges(p_Parsed->p_Ranges);
+
+    return p_Parsed;
+}
+
+
+FastInput* FastReloadInput(RunOptions& Options, CompiledReader& Reader)
+{
+    //Reads the payload the reference engine compiles, the flat {min, max} pairs are already in order
+    RunArena& Arena {*Options.p_Arena};
+    FastInput* p_Parsed = Arena.Create<FastInput>();
+
+    std::size_t RangeValues {0};
+    const long unsigned int* p_Ranges {Reader.GetArray<long unsigned int>(RangeValues)};
+    std::size_t IngredientCount {0};
+    const long unsigned int* p_Ingredients {Reader.GetArray<long unsigned int>(IngredientCount)};
+
+    p_Parsed->p_Ranges = Arena.Create<std::pmr::vector<FreshRange>>(&Arena);
+    p_Parsed->p_Ranges->reserve(RangeValues / 2);
+    for(std::size_t i_Value {0}; i_Value + 1 < RangeValues; i_Value += 2)
+    {
+        p_Parsed->p_Ranges->emplace_back(FreshRange {p_Ranges[i_Value], p_Ranges[i_Value + 1]});
+    }
+    CollapseRanges(p_Parsed->p_Ranges);
+
+    p_Parsed->p_VectorOfIngredients = Arena.Create<std::pmr::vector<long unsigned int>>(p_Ingredients, p_Ingredients + IngredientCount, &Arena);
+
+    return p_Parsed;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    std::pmr::vector<FreshRange>& Ranges {*p_Parsed->p_Ranges};
+    int Tally {0};
+
+    for(long unsigned int IngredientID : *p_Parsed->p_VectorOfIngredients)
+    {
+        //The first collapsed range starting past the ID, the one before it is the only one that can hold it
+        auto it {std::upper_bound(Ranges.begin(), Ranges.end(), IngredientID, [](long unsigned int ID, const FreshRange& Range){return ID < Range.Minimum;})};
+        if(it != Ranges.begin() && IngredientID <= (it - 1)->Maximum){++Tally;}
+    }
+
+    return std::to_string(Tally);
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    long unsigned int Tally {0};
+    for(FreshRange& Range : *p_Parsed->p_Ranges){Tally += Range.Maximum - Range.Minimum + 1;}
+
+    return std::to_string(Tally);
+}
+
+} //namespace Day05
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day05::ParsedInput>(5, '\n', Day05::ParseInput, Day05::AnswerProblemOne, Day05::AnswerProblemTwo)};
+static bool RegisteredStream {RegisterStreamingDay(5, Day05::StreamBothProblems)};
+static bool RegisteredCompiled {RegisterCompiledDay<Day05::ParsedInput>(5, Day05::CompileInput, Day05::ReloadInput)};
+static bool RegisteredFast {RegisterFastEngine<Day05::FastInput>(5, Day05::FastParseInput, Day05::FastAnswerProblemOne, Day05::FastAnswerProblemTwo, Day05::FastReloadInput)};
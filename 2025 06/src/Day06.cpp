@@ -19,48 +19,16 @@ General approach:
 
 #include <iostream>
 #include <vector>
-#include <fstream>
 #include <string>
-#include <ctime>
 
-
-std::vector<std::string>* GetFileData(std::string DataPath)
-{
-    //Read the input text file line by line and create a vector that can be used during runtime
-    
-    //Setting up variables to stream data and store it into a vector
-    std::vector<std::string>* p_VectorOfLines = new std::vector<std::string>;
-    std::ifstream FileStream(DataPath);
-    std::string Line;
-
-    //Read the data stream and store lines in Line
-    if(FileStream.is_open())
-    {
-        while(getline(FileStream, Line))
-        {
-            p_VectorOfLines->emplace_back(Line);
-        }
-    }
-    else //Error handling if file cannot be opened
-    {
-        std::cout << "Cannot open file" << std::endl;
-    }
-
-    return p_VectorOfLines;
-}
+#include "InputLoader.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+#include "Trace.h"
 
 
-void PrintTimeNow()
+namespace Day06
 {
-    //Function to print specific time points if required
-
-    std::time_t Now;
-    struct tm* Local;
-    std::time(&Now);
-    Local = std::localtime(&Now);
-    std::cout << std::asctime(Local); 
-}
-
 
 int GetVectorSum(std::vector<int>& VectorOfInts)
 {
@@ -89,7 +57,7 @@ long unsigned int GetVectorProduct(std::vector<int>& VectorOfInts)
 }
 
 
-int GetCleanNumber(std::string& LineFromInput, int NumberRoot, int NumberEnd)
+int GetCleanNumber(std::string_view LineFromInput, int NumberRoot, int NumberEnd)
 {
     //Isolate a number from a given string segment in a line
 
@@ -111,7 +79,7 @@ int GetCleanNumber(std::string& LineFromInput, int NumberRoot, int NumberEnd)
 }
 
 
-int GetCephalodNumber(std::vector<std::string>* p_InputDataVector, int i_NumberInString, int LastLineIndex)
+int GetCephalodNumber(InputLines* p_InputDataVector, int i_NumberInString, int LastLineIndex)
 {
     //Very similar to GetCleanNumber, just adapted to read index by index, line by line
 
@@ -148,8 +116,10 @@ void ProcessNumberBlock(char OperatorSymbol, std::vector<int>& VectorOfNumbers,
 }
 
 
-std::vector<long unsigned int> ReadNumbers(int& Timed, std::vector<std::string>* p_InputDataVector)
+std::vector<long unsigned int> ReadNumbers(int& Timed, InputLines* p_InputDataVector)
 {
+    TraceSpan Span {"ReadNumbers"};
+
     if(Timed){std::cout << "Starting combined Problem One and Two:    ";PrintTimeNow();}
 
     //Based on the index of the operator in the last line, the entire input can be 'chunked'
@@ -162,7 +132,7 @@ std::vector<long unsigned int> ReadNumbers(int& Timed, std::vector<std::string>*
     int LastLineIndex {(int)p_InputDataVector->size() - 1};
 
     //The line of operators will be used to slice the rest of the input into chunks
-    std::string OperatorsLine {(*p_InputDataVector)[LastLineIndex]};
+    std::string_view OperatorsLine {(*p_InputDataVector)[LastLineIndex]};
     int LineLength {(int)OperatorsLine.size()};
     int NumberIndexRoot {0};
 
@@ -233,28 +203,42 @@ std::vector<long unsigned int> ReadNumbers(int& Timed, std::vector<std::string>*
 }
 
 
-int main(int argc, char* argv[])
-{  
-    //Keep track of if this run should be timed or not, default is False
-    int Timed {0};
-    if(argc >= 3){Timed = std::stoi(argv[2]);}
-    if(Timed){PrintTimeNow();}
-    
-    //The Puzzle Input Data as a POINTER to a vector of strings
-    std::vector<std::string>* p_InputDataVector {GetFileData(argv[1])};
+struct ParsedInput
+{
+    //Both problems are answered in the same pass over the input, the second answer is kept here until it is asked for
+    InputLines* p_InputDataVector {nullptr};
+    std::vector<long unsigned int> BothProblemAnswers {};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
 
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
     //Process the whole input file, chunking it into blocks as delimited by the operator in the last line of the input file
     //Whenever considering such a chunk, process the numbers for both problem 1 as well as problem 2 
-    std::vector<long unsigned int> BothProblemAnswers {ReadNumbers(Timed, p_InputDataVector)};
+    p_Parsed->BothProblemAnswers = ReadNumbers(Options.Timed, p_Parsed->p_InputDataVector);
+
+    return std::to_string(p_Parsed->BothProblemAnswers[0]);
+}
+
 
-    std::cout << "Problem One:\n" << BothProblemAnswers[0] << std::endl;
-    std::cout << "Problem Two:\n" << BothProblemAnswers[1] << std::endl;
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    if(p_Parsed->BothProblemAnswers.empty()){p_Parsed->BothProblemAnswers = ReadNumbers(Options.Timed, p_Parsed->p_InputDataVector);}
+
+    return std::to_string(p_Parsed->BothProblemAnswers[1]);
+}
 
-    //Cleaning up
-    delete p_InputDataVector;
-    p_InputDataVector = nullptr;
+} //namespace Day06
 
-    std::cout << "\nTotal runtime: " <<  1.0 * clock() /CLOCKS_PER_SEC << "s\n";
 
-    return 0;
-}
\ No newline at end of file
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day06::ParsedInput>(6, '\n', Day06::ParseInput, Day06::AnswerProblemOne, Day06::AnswerProblemTwo)};
@@ -0,0 +1,271 @@
+/*
+General approach: 
+
+    Iteratively build a map of beam location indices, where each index corresponds to how many ways a beam could get there
+
+    Starting on the first line, isolate the index of S, this will be the first beam index set to 1
+    For each line afterwards, loop through each index in the line
+    
+    if Line[index] == '^'                  <- split the beam
+
+        Line[index - 1] += Line[index]     <- Tally up the different ways a beam could get to that index
+        Line[index + 1] += Line[index]
+            
+        Line[index] = 0;                   <- Because the splitter blocks further traversal down   
+
+    This simulates how the beam splits
+
+    Every time the beam splits, tally it
+
+    Eventually, all that remains is the final beam indices and in how many different ways they could've gotten there
+    summing all these up gives the final total of timelines.
+
+Fast engine (--engine=fast):
+    The above stays as the reference. Beams can only ever sit between one column left of the grid and one column
+    right of it, so the fast engine keeps them in a flat array of GridWidth + 2 counters instead of a map, and only
+    stops at the '^' in each row (memchr) instead of at every column
+
+    Splitting still goes left to right within a row, so a beam split into the next column can be split again by a
+    '^' right next to it, exactly like the reference does
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+
+#include "InputLoader.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day07
+{
+
+void PropagateBeamRow(std::string_view Line, int GridWidth, std::map<int, unsigned long int>& ActiveBeams, long unsigned int& TotalSplits)
+{
+    //Move the beams down a single row of the grid, splitting them wherever they hit a '^'
+    for(int i_Line {0}; i_Line < GridWidth; ++i_Line)
+    {
+        if(Line[i_Line] == '^' && ActiveBeams[i_Line])
+        {
+            //Beam is splitting to -1 and +1 the current index, leaving the current index blank
+            
+            ActiveBeams[i_Line - 1] += ActiveBeams[i_Line];
+            ActiveBeams[i_Line + 1] += ActiveBeams[i_Line];
+            ActiveBeams[i_Line]      = 0;
+
+            //Tally this as a location where the beam is split
+            ++TotalSplits;
+        }
+    }
+}
+
+
+long unsigned int CountBeams(std::map<int, unsigned long int>& ActiveBeams)
+{
+    //After the simulation has been run, all that is left is a final map with all (active and inactive) beam indices
+    //And in how many ways they could've gotten there
+    long unsigned int CumulativeBeams {0};
+
+    for(auto Beam : ActiveBeams)
+    {
+        //Filter out inactive indices 
+        if(Beam.second) 
+        {
+            CumulativeBeams += Beam.second;
+        }
+    }
+
+    return CumulativeBeams;
+}
+
+
+void SimulateBeamSplitting(InputLines* p_InputDataVector, long unsigned int& TotalSplits, long unsigned int& CumulativeBeams, int& Timed)
+{
+    TraceSpan Span {"SimulateBeamSplitting"};
+
+    if(Timed){std::cout << "Simulating beam splitting:    ";PrintTimeNow();}
+    
+    //Loop through each line, each index in the line and compare active beam indices to found '^' chars
+
+    //Snagging some grid data
+    std::string_view TopLine {(*p_InputDataVector)[0]};
+    int GridWidth {(int)TopLine.size()};
+    auto it {std::find(TopLine.begin(), TopLine.end(), 'S')};
+
+    //Tracking active beams here, starting with just the index of the 'S' in the TopLine
+    std::map<int, unsigned long int> ActiveBeams {{std::distance(TopLine.begin(), it), true}};
+
+    //Simulate the beam traversing down the grid
+    for(std::string_view Line : (*p_InputDataVector))
+    {
+        PropagateBeamRow(Line, GridWidth, ActiveBeams, TotalSplits);
+    }
+
+    CumulativeBeams += CountBeams(ActiveBeams);
+
+    if(Timed){std::cout << "Simulation finished:          ";PrintTimeNow();}
+}
+
+
+struct ParsedInput
+{
+    //Both problems come out of the same simulation, the second answer is kept here until it is asked for
+    InputLines* p_InputDataVector {nullptr};
+    bool Simulated {false};
+
+    //Keep track of how often the beam is split
+    long unsigned int TotalBeamSplits {0};
+    long unsigned int CumalativeBeams {0};
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+void RunSimulationOnce(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    //Run the beam splitting simulation, but only the first time either problem asks for it
+    if(!p_Parsed->Simulated)
+    {
+        SimulateBeamSplitting(p_Parsed->p_InputDataVector, p_Parsed->TotalBeamSplits, p_Parsed->CumalativeBeams, Options.Timed);
+        p_Parsed->Simulated = true;
+    }
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    RunSimulationOnce(Options, p_Parsed);
+
+    return std::to_string(p_Parsed->TotalBeamSplits);
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    RunSimulationOnce(Options, p_Parsed);
+
+    return std::to_string(p_Parsed->CumalativeBeams);
+}
+
+void StreamBothProblems(RunOptions& Options, LineStream& InputStream, std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //The beams only ever move one row down, so the grid can be fed in row by row while it streams past
+    //The only state is the map of active beams, which is bound by the width of the grid
+
+    if(Options.Timed){std::cout << "Simulating streamed beam splitting:    ";PrintTimeNow();}
+
+    long unsigned int TotalSplits {0};
+    int GridWidth {-1};
+    std::map<int, unsigned long int> ActiveBeams {};
+
+    std::string_view Line;
+    while(InputStream.NextLine(Line))
+    {
+        if(GridWidth < 0)
+        {
+            //Tracking active beams here, starting with just the index of the 'S' in the top line
+            GridWidth = (int)Line.size();
+            ActiveBeams[(int)Line.find('S')] = true;
+        }
+
+        PropagateBeamRow(Line, GridWidth, ActiveBeams, TotalSplits);
+    }
+
+    AnswerOne = std::to_string(TotalSplits);
+    AnswerTwo = std::to_string(CountBeams(ActiveBeams));
+
+    if(Options.Timed){std::cout << "Streamed simulation finished:          ";PrintTimeNow();}
+}
+
+
+struct FastInput
+{
+    InputLines* p_InputDataVector {nullptr};
+    bool Simulated {false};
+
+    long unsigned int TotalBeamSplits {0};
+    long unsigned int CumulativeBeams {0};
+};
+
+
+FastInput* FastParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    FastInput* p_Parsed = Options.p_Arena->Create<FastInput>();
+    p_Parsed->p_InputDataVector = p_InputDataVector;
+
+    return p_Parsed;
+}
+
+
+void FastSimulateBeamSplitting(RunOptions& Options, FastInput* p_Parsed)
+{
+    TraceSpan Span {"FastSimulateBeamSplitting"};
+
+    InputLines& Grid {*p_Parsed->p_InputDataVector};
+    std::string_view TopLine {Grid[0]};
+    int GridWidth {(int)TopLine.size()};
+
+    //Column X of the grid is Beams[X + 1], the two extra ones catch beams split off the sides
+    std::pmr::vector<long unsigned int> Beams(GridWidth + 2, 0, Options.p_Arena);
+    std::size_t Start {TopLine.find('S')};
+    Beams[(Start == std::string_view::npos ? GridWidth : (int)Start) + 1] = 1;
+
+    for(std::string_view Line : Grid)
+    {
+        const char* p_Row {Line.data()};
+        std::size_t RowWidth {std::min(Line.size(), (std::size_t)GridWidth)};
+
+        //Jump from splitter to splitter, the rest of the row leaves the beams alone
+        for(const char* p_Splitter {(const char*)std::memchr(p_Row, '^', RowWidth)}; p_Splitter;
+            p_Splitter = (const char*)std::memchr(p_Splitter + 1, '^', RowWidth - (p_Splitter + 1 - p_Row)))
+        {
+            long unsigned int& Beam {Beams[p_Splitter - p_Row + 1]};
+            if(!Beam){continue;}
+
+            (&Beam)[-1] += Beam;
+            (&Beam)[1] += Beam;
+            Beam = 0;
+            ++p_Parsed->TotalBeamSplits;
+        }
+    }
+
+    for(long unsigned int Beam : Beams){p_Parsed->CumulativeBeams += Beam;}
+    p_Parsed->Simulated = true;
+}
+
+
+std::string FastAnswerProblemOne(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Simulated){FastSimulateBeamSplitting(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->TotalBeamSplits);
+}
+
+
+std::string FastAnswerProblemTwo(RunOptions& Options, FastInput* p_Parsed)
+{
+    if(!p_Parsed->Simulated){FastSimulateBeamSplitting(Options, p_Parsed);}
+
+    return std::to_string(p_Parsed->CumulativeBeams);
+}
+
+} //namespace Day07
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day07::ParsedInput>(7, '\n', Day07::ParseInput, Day07::AnswerProblemOne, Day07::AnswerProblemTwo)};
+static bool RegisteredStream {RegisterStreamingDay(7, Day07::StreamBothProblems)};
+static bool RegisteredFast {RegisterFastEngine<Day07::FastInput>(7, Day07::FastParseInput, Day07::FastAnswerProblemOne, Day07::FastAnswerProblemTwo)};
@@ -0,0 +1,385 @@
+/*
+General problem approach:   
+    Generate a map of all areas per tiles pair
+        i.e.  Map[50] = {{2,5},{11,1}}
+    
+    By definition, the largest possible area is the last entry in the map
+    >This will answer problem 1
+
+    The tile coordinates are parsed once up front into a flat {X0, Y0, X1, Y1, ...} array, everything after that works on
+    indices into it
+
+    For problem 2, generate all green tiles by just marching through the tile coordinates
+    Now, for each area as listed in the previously generated map, starting at the largest area
+
+        1. Get the coordinates for the area 
+        2. Check if ANY of the green tiles are within the area (perimeter is ok)
+            if so: the perimeter dissects the area and therefore the area cannot be valid, break
+        3. first pair of tiles to create an area which is not dissected by green tiles is, by definition, the largest possible area
+        4. Weep, because this seems like a daft way to sledgehammer this problem
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <array>
+#include <memory_resource>
+#include <algorithm>
+
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "CompiledInput.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day09
+{
+
+std::pmr::vector<int>* GetTileCoordinates(InputLines* p_InputDataVector, RunArena& Arena)
+{
+    //Turn every "X,Y" line into two ints, one after the other
+    std::pmr::vector<int>* p_TileCoordinates = Arena.Create<std::pmr::vector<int>>(p_InputDataVector->size() * 2, 0, &Arena);
+
+    for(int i_Line {0}; i_Line < (int)p_InputDataVector->size(); ++i_Line)
+    {
+        NumberParsing::ParsePair((*p_InputDataVector)[i_Line], (*p_TileCoordinates)[i_Line * 2], (*p_TileCoordinates)[i_Line * 2 + 1]);
+    }
+
+    return p_TileCoordinates;
+}
+
+
+long unsigned int GetRectArea(const int* p_OriginXY, const int* p_ProjectedXY)
+{
+    //Get the area between the two opposite points of a rectangle
+
+    //Stores {Xo, Yo, Xt, Yt}
+    int ExtractedInts[4] {p_OriginXY[0], p_OriginXY[1], p_ProjectedXY[0], p_ProjectedXY[1]};
+
+    //Remember to +1 the area, as the square itself is already 1x1
+    long unsigned int TotalArea {(long unsigned int)(std::abs(ExtractedInts[0] - ExtractedInts[2]) + 1) *
+                                 (long unsigned int)(std::abs(ExtractedInts[1] - ExtractedInts[3]) + 1) };
+
+    return TotalArea;
+}
+
+
+std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>* GenerateAreasMap(const int* p_TileCoordinates, int TileCount, RunArena& Arena)
+{
+    //Create a map where each resulting area links to the coordinate pair that constitutes it
+    //Every node, pair vector and pair in here is handed the arena by the map, nothing touches the heap
+    std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>* p_AreasMap = Arena.Create<std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>>(&Arena);
+    
+    //Bounds data
+    int MaxLine {TileCount};
+
+    //Get the areas between each coordinate point and the following coordinate points
+    //No need to do each to all each iteration since a -> b is the same as a <- b
+    for(int i_Line {0}; i_Line < MaxLine; ++i_Line)
+    {
+        for(int i_FollowingLine {i_Line + 1}; i_FollowingLine < MaxLine; ++i_FollowingLine)
+        {
+            long unsigned int Area = GetRectArea(p_TileCoordinates + i_Line * 2, p_TileCoordinates + i_FollowingLine * 2);
+            (*p_AreasMap)[Area].emplace_back(std::initializer_list<int> {i_Line, i_FollowingLine});
+        }
+    }
+
+    return p_AreasMap;
+}
+
+
+std::array<int, 4> GetConnectedTileCoordinates(const int* p_Origin, const int* p_Projection)
+{
+    //Take in two tile coordinates and turn them into a single array for processing
+    //This runs for every rectangle Problem 2 looks at, a fixed size array keeps that off the heap
+
+    //Xo, Yo, Xp, Yp
+    std::array<int, 4> ExtractedInts {p_Origin[0], p_Origin[1], p_Projection[0], p_Projection[1]};
+
+    //Sort them in order from smallest to largest
+    if(ExtractedInts[0] > ExtractedInts[2])
+    {
+        int TempInt {ExtractedInts[0]};
+        ExtractedInts[0] = ExtractedInts[2];
+        ExtractedInts[2] = TempInt;
+    }
+    if(ExtractedInts[1] > ExtractedInts[3])
+    {
+        int TempInt {ExtractedInts[1]};
+        ExtractedInts[1] = ExtractedInts[3];
+        ExtractedInts[3] = TempInt;
+    }
+
+    return ExtractedInts;
+}
+
+
+std::pmr::map<int, std::pmr::vector<int>>* GetMapOfGreenTiles(const int* p_TileCoordinates, int TileCount, RunArena& Arena)
+{
+    //Process all the input tile coordinates to generate a map where each X coordinate
+    //maps to the collection of Y coordinates
+
+    std::pmr::map<int, std::pmr::vector<int>>* p_MapOfTiles = Arena.Create<std::pmr::map<int, std::pmr::vector<int>>>(&Arena);
+
+    //Setting bounds
+    int MaxLine {TileCount};
+
+    for(int i_Line {0}; i_Line < MaxLine; ++i_Line)
+    {
+        //Start from this tile
+        const int* OriginTile {p_TileCoordinates + i_Line * 2};
+        const int* ProjectTile;
+
+        if(i_Line == MaxLine - 1)
+        {
+            //Connect the last Tile to the first Tile
+            ProjectTile  = p_TileCoordinates;
+        }
+        else
+        {
+            //Connect this Tile to the next Tile in the input
+            ProjectTile = p_TileCoordinates + (i_Line + 1) * 2;
+        }
+
+        //Get the rectangle coordinates from smallest XY corner to largest XY corner
+        std::array<int, 4> ExtractedInts {GetConnectedTileCoordinates(OriginTile, ProjectTile)};
+
+        //March along the Y axis if X is constant
+        if(ExtractedInts[0] == ExtractedInts[2])
+        {
+            for(int StepY {ExtractedInts[1]}; StepY <= ExtractedInts[3]; ++StepY)
+            {
+                (*p_MapOfTiles)[ExtractedInts[0]].emplace_back(StepY);
+            }
+        }
+        //March along the X axis if Y is constant
+        else
+        {
+            for(int StepX {ExtractedInts[0]}; StepX <= ExtractedInts[2]; ++StepX)
+            {
+                (*p_MapOfTiles)[StepX].emplace_back(ExtractedInts[1]);
+            }
+        }
+    }
+
+    return p_MapOfTiles;
+}
+
+
+long unsigned int SolveProblemOne(int& Timed, std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>* p_MapOfPoorLifeChoices)
+{
+    if(Timed){std::cout << "Starting Problem One:    ";PrintTimeNow();}
+    //Look, I made this.
+    //I have to live with this.
+    //How do you think >I< feel, writing this?
+
+    //Extract the final key 
+    auto LastPair {std::prev(p_MapOfPoorLifeChoices->end())};
+    long unsigned int LargestArea = LastPair->first;
+
+    if(Timed){std::cout << "Ending Problem One:      ";PrintTimeNow();}
+    return LargestArea;
+}
+
+
+long unsigned int SolveProblemTwo(int& Timed, std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>* p_MapOfPoorLifeChoices, std::pmr::map<int, std::pmr::vector<int>>* p_MapOfGreenTiles,
+                                  const int* p_TileCoordinates)
+{
+    //And here we come now at the rising cresendo of this opera of inefficiency
+    //The magnum opus of making sure my laptop hates me
+    //Starting with the largest area, for the points listed that make up the area
+    //check if any of the green tiles are within the body of the rect (perimeter is fine)
+
+    if(Timed){std::cout << "Starting Problem Two:    ";PrintTimeNow();}
+    
+    //Iterate over the map in reverse order
+    for(auto IterateRects {p_MapOfPoorLifeChoices->rbegin()}; IterateRects != p_MapOfPoorLifeChoices->rend(); ++IterateRects)
+    {
+        //For each area, look at each two tiles that make up that area
+        for(const std::pmr::vector<int>& PairOfTileLines : IterateRects->second)
+        {
+            bool Fits {true};
+
+            const int* Origin  {p_TileCoordinates + PairOfTileLines[0] * 2};
+            const int* Project {p_TileCoordinates + PairOfTileLines[1] * 2};
+
+            //{Xmin, Ymin, Xmax, Ymax}
+            std::array<int, 4> ExtractedInts {GetConnectedTileCoordinates(Origin, Project)};
+
+            //Check each green tile between (Xmin,Ymin) and (Xmax,Ymax) if it is within the body of the rect that can be constructed from the connected tiles
+            //It is ok to cry
+            
+            //The downright hamfisted loop here basically means:
+            //Between Xmin and Xmax exclusive, check for green tiles
+            //Exclusive, not inclusive, because we do not care about green tiles in the perimeter
+            for(auto IterateGreenTiles {p_MapOfGreenTiles->find(ExtractedInts[0] + 1)}; IterateGreenTiles != p_MapOfGreenTiles->find(ExtractedInts[2] - 1); ++IterateGreenTiles)
+            {   
+                for(int GreenTileY : IterateGreenTiles->second)
+                {
+                    if(GreenTileY > ExtractedInts[1] && GreenTileY < ExtractedInts[3])
+                    {
+                        //There exists a green tile within the body of the rectangle, so it cannot be valid
+                        Fits = false;
+                        break;
+                    }
+                }
+                
+                if(!Fits)
+                {
+                    //stop checking invalid rectangles
+                    break;
+                }
+            }
+            if(Fits)
+            {   
+                //return the first Area that is able to pass the filtering check
+                if(Timed){std::cout << "Ending Problem Two:      ";PrintTimeNow();}
+                return IterateRects->first;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+
+struct ParsedInput
+{
+    //The tile coordinates, either in the run arena or pointing into a compiled input, next to both maps built from them
+    std::pmr::vector<int>* p_TileCoordinates {nullptr};
+    const int* p_Coordinates {nullptr};
+    int TileCount {0};
+    std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>* p_MapOfPoorLifeChoices {nullptr};
+    std::pmr::map<int, std::pmr::vector<int>>* p_MapOfGreenTiles {nullptr};
+};
+
+
+void BuildMaps(ParsedInput* p_Parsed, RunArena& Arena)
+{
+    TraceSpan Span {"BuildMaps"};
+
+    //This is a map of all possible areas as constructed from the tiles given in the input, as indices of the tile in said input
+    //It is also the thing that makes me wonder if I should keep trudging on doing AoC puzzles
+    p_Parsed->p_MapOfPoorLifeChoices = GenerateAreasMap(p_Parsed->p_Coordinates, p_Parsed->TileCount, Arena);
+
+    //This is a map linking all [x] tiles to their collection of available [y] tiles
+    //There WILL be around 500 duplicates scattered about the [y] vectors
+    //but I am a tired man and simply wish to move on
+    p_Parsed->p_MapOfGreenTiles = GetMapOfGreenTiles(p_Parsed->p_Coordinates, p_Parsed->TileCount, Arena);
+}
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ParsedInput* p_Parsed = Arena.Create<ParsedInput>();
+
+    p_Parsed->p_TileCoordinates = GetTileCoordinates(p_InputDataVector, Arena);
+    p_Parsed->p_Coordinates = p_Parsed->p_TileCoordinates->data();
+    p_Parsed->TileCount = (int)p_InputDataVector->size();
+
+    BuildMaps(p_Parsed, Arena);
+
+    return p_Parsed;
+}
+
+
+struct CompiledArea
+{
+    //One pair of tiles in the areas map, as stored in a compiled input
+    long unsigned int Area {0};
+    int FirstTile {0};
+    int SecondTile {0};
+};
+
+
+void CompileInput(ParsedInput* p_Parsed, CompiledWriter& Writer)
+{
+    //Building both maps is where the parse time goes, so they are stored flattened next to the coordinates
+    Writer.PutArray(p_Parsed->p_Coordinates, p_Parsed->TileCount * 2);
+
+    //Areas map: every tile pair with its area, already in key order
+    std::vector<CompiledArea> Areas {};
+    for(auto& AreaAndPairs : *p_Parsed->p_MapOfPoorLifeChoices)
+    {
+        for(std::pmr::vector<int>& Pair : AreaAndPairs.second){Areas.emplace_back(CompiledArea {AreaAndPairs.first, Pair[0], Pair[1]});}
+    }
+    Writer.PutArray(Areas.data(), Areas.size());
+
+    //Green tiles map: the X keys, how many Ys each has, then all Ys back to back
+    std::vector<int> Keys {};
+    std::vector<std::uint64_t> Counts {};
+    std::vector<int> Ys {};
+    for(auto& XAndYs : *p_Parsed->p_MapOfGreenTiles)
+    {
+        Keys.emplace_back(XAndYs.first);
+        Counts.emplace_back(XAndYs.second.size());
+        Ys.insert(Ys.end(), XAndYs.second.begin(), XAndYs.second.end());
+    }
+    Writer.PutArray(Keys.data(), Keys.size());
+    Writer.PutArray(Counts.data(), Counts.size());
+    Writer.PutArray(Ys.data(), Ys.size());
+}
+
+
+ParsedInput* ReloadInput(RunOptions& Options, CompiledReader& Reader)
+{
+    RunArena& Arena {*Options.p_Arena};
+    ParsedInput* p_Parsed = Arena.Create<ParsedInput>();
+
+    //Coordinates straight out of the mapping, no copy
+    std::size_t CoordinateCount {0};
+    p_Parsed->p_Coordinates = Reader.GetArray<int>(CoordinateCount);
+    p_Parsed->TileCount = (int)(CoordinateCount / 2);
+
+    std::size_t AreaCount {0};
+    const CompiledArea* p_Areas {Reader.GetArray<CompiledArea>(AreaCount)};
+    std::size_t KeyCount {0};
+    const int* p_Keys {Reader.GetArray<int>(KeyCount)};
+    std::size_t CountCount {0};
+    const std::uint64_t* p_Counts {Reader.GetArray<std::uint64_t>(CountCount)};
+    std::size_t YCount {0};
+    const int* p_Ys {Reader.GetArray<int>(YCount)};
+
+    //Both maps come back in key order, so every insert goes straight to the end
+    p_Parsed->p_MapOfPoorLifeChoices = Arena.Create<std::pmr::map<long unsigned int, std::pmr::vector<std::pmr::vector<int>>>>(&Arena);
+    for(std::size_t i_Area {0}; i_Area < AreaCount; ++i_Area)
+    {
+        auto Entry {p_Parsed->p_MapOfPoorLifeChoices->try_emplace(p_Parsed->p_MapOfPoorLifeChoices->end(), p_Areas[i_Area].Area)};
+        Entry->second.emplace_back(std::initializer_list<int> {p_Areas[i_Area].FirstTile, p_Areas[i_Area].SecondTile});
+    }
+
+    p_Parsed->p_MapOfGreenTiles = Arena.Create<std::pmr::map<int, std::pmr::vector<int>>>(&Arena);
+    std::size_t YOffset {0};
+    for(std::size_t i_Key {0}; i_Key < KeyCount && i_Key < CountCount; ++i_Key)
+    {
+        if(YOffset + p_Counts[i_Key] > YCount){Reader.Failed = true; break;}
+        p_Parsed->p_MapOfGreenTiles->try_emplace(p_Parsed->p_MapOfGreenTiles->end(), p_Keys[i_Key], p_Ys + YOffset, p_Ys + YOffset + p_Counts[i_Key]);
+        YOffset += p_Counts[i_Key];
+    }
+
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_MapOfPoorLifeChoices));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_MapOfPoorLifeChoices, p_Parsed->p_MapOfGreenTiles, p_Parsed->p_Coordinates));
+}
+
+} //namespace Day09
+
+
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day09::ParsedInput>(9, '\n', Day09::ParseInput, Day09::AnswerProblemOne, Day09::AnswerProblemTwo, 100)};
+static bool RegisteredCompiled {RegisterCompiledDay<Day09::ParsedInput>(9, Day09::CompileInput, Day09::ReloadInput)};
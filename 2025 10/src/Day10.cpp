@@ -1,6 +1,6 @@
 /*
 Problem 1 approach:
-    First and foremost, the input data has to be processed properly. To this end we shall use a combination of stringstream and my cursed take on regex
+    First and foremost, the input data has to be processed properly. Every part of a line sits between its own kind of brackets, so it is a matter of finding those and handing the numbers in between to the shared NumberParsing helpers
     Every line will be represented as a struct of three members:
         1. The string with the intended final configuration of lights
         2. The listed buttons and what lights they toggle
@@ -44,13 +44,20 @@ Problem 2 approach:
 
 #include <iostream>
 #include <vector>
-#include <fstream>
 #include <string>
-#include <ctime>
-#include <regex>
-#include <sstream>
+#include <map>
 #include <algorithm>
 
+#include "InputLoader.h"
+#include "NumberParsing.h"
+#include "CompiledInput.h"
+#include "SolverRegistry.h"
+#include "Timing.h"
+#include "Trace.h"
+
+
+namespace Day10
+{
 
 struct ManualLine
 {
@@ -62,44 +69,6 @@ struct ManualLine
 };
 
 
-std::vector<std::string>* GetFileData(std::string DataPath)
-{
-    //Read the input text file line by line and create a vector that can be used during runtime
-    
-    //Setting up variables to stream data and store it into a vector
-    std::vector<std::string>* p_VectorOfLines = new std::vector<std::string>;
-    std::ifstream FileStream(DataPath);
-    std::string Line;
-
-    //Read the data stream and store lines in Line
-    if(FileStream.is_open())
-    {
-        while(getline(FileStream, Line))
-        {
-            p_VectorOfLines->emplace_back(Line);
-        }
-    }
-    else //Error handling if file cannot be opened
-    {
-        std::cout << "Cannot open file" << std::endl;
-    }
-
-    return p_VectorOfLines;
-}
-
-
-void PrintTimeNow()
-{
-    //Function to print specific time points if required
-
-    std::time_t Now;
-    struct tm* Local;
-    std::time(&Now);
-    Local = std::localtime(&Now);
-    std::cout << std::asctime(Local); 
-}
-
-
 void PrintInput(std::vector<ManualLine>* p_RegexdInputData)
 {
     //This is just to easily visualise the input file for troubleshooting purposes
@@ -141,82 +110,58 @@ void PrintInput(std::vector<ManualLine>* p_RegexdInputData)
 }
 
 
-std::vector<ManualLine>* GenerateManualLines(int& Timed, std::vector<std::string>* p_InputDataVector)
+std::vector<ManualLine>* GenerateManualLines(int& Timed, InputLines* p_InputDataVector)
 {
+    TraceSpan Span {"GenerateManualLines"};
+
     if(Timed){std::cout<< "Starting processing input file: "; PrintTimeNow();}
     
     //Go through each of the lines in the input and separate its contents into relevant substructures
-    //This will be a regex chop shop
+    //Line layout: [.##.] (3) (1,3) (2) {3,5,4,7}
 
     std::vector<ManualLine>* p_ManualLines = new std::vector<ManualLine>;
 
-    //Patterns to isolate
-    std::regex Config("\\[([.#]+)\\]");     //Grab bracketed substring containing one or more '.' or '#'
-    std::regex Buttons("\\(([^\\s]*)\\)");  //Grab ALL braced substrings without spaces
-    std::regex Joltage("\\{([^]*)\\}");     //Grab curly braced substring with anything inside (for this input thtat's ok)
-
-    for(std::string Line : *p_InputDataVector)
+    //Contents between an opening and closing character, starting the search at Position, which is moved past the closing one
+    auto GetEnclosed = [](std::string_view Line, char Open, char Close, std::size_t& Position, std::string_view& Contents)
     {
-        //Holds the result of regex_search
-        std::smatch Match;
-
-        //Iterator for iterating over all buttons in the buttons substring
-        auto LineBegin = std::sregex_iterator(Line.begin(), Line.end(), Buttons);
-        auto LineEnd   = std::sregex_iterator();
+        std::size_t OpenAt {Line.find(Open, Position)};
+        if(OpenAt == std::string_view::npos){return false;}
+        std::size_t CloseAt {Line.find(Close, OpenAt + 1)};
+        if(CloseAt == std::string_view::npos){return false;}
 
-        //Setting up some StringStream variables
-        std::string SingleIntAsString {};
+        Contents = Line.substr(OpenAt + 1, CloseAt - OpenAt - 1);
+        Position = CloseAt + 1;
+        return true;
+    };
 
+    for(std::string_view Line : *p_InputDataVector)
+    {
         //Create a new ManuaLine struct to hold all neatly chopped up information
         ManualLine NewEntry {};
+        std::string_view Contents {};
 
-        //Isolate the Target Configuration
-        if(std::regex_search(Line, Match, Config))
+        //Isolate the Target Configuration, which is just the string without the brackets
+        std::size_t Position {0};
+        if(GetEnclosed(Line, '[', ']', Position, Contents))
         {
-            //By accessing Match[1], we're snagging the contents of the first capturing group
-            //Which is just the string without the braces
-            NewEntry.TargetConfig = Match[1];
+            NewEntry.TargetConfig = std::string(Contents);
         }
 
         //Isolate all the Button and their effects as a nested vector
-        if(std::regex_search(Line, Match, Buttons))
-        {   
-            //Nested vector to hold all button data
-            std::vector<std::vector<int>> ButtonsVector {};
-
-            for(auto IterateButtons {LineBegin}; IterateButtons != LineEnd; ++IterateButtons)
-            {
-                std::vector<int> SingleButtonCombination {};
-
-                //As of here, (*IterateButtons)[1] will point to a substring of just the comma separated numbers
-                //Now it is time to start isolating the ints from the string
-                //Probably more elegant with regex, but regex scary
-
-                std::stringstream Stream ((*IterateButtons)[1]);
-                while(getline(Stream, SingleIntAsString, ','))
-                {
-                    SingleButtonCombination.emplace_back(std::stoi(SingleIntAsString));
-                }
-                ButtonsVector.emplace_back(SingleButtonCombination);
-            }
-
-            NewEntry.Buttons = ButtonsVector;
+        //The buttons all come before the joltages, so stop looking once past the curly brace
+        std::size_t JoltageAt {Line.find('{')};
+        while(GetEnclosed(Line, '(', ')', Position, Contents) && Position < JoltageAt)
+        {
+            std::vector<int> SingleButtonCombination {};
+            NumberParsing::ParseList(Contents, SingleButtonCombination);
+            NewEntry.Buttons.emplace_back(SingleButtonCombination);
         }
 
-        //Isolate the Joltage requirements
-        if(std::regex_search(Line, Match, Joltage))
+        //Isolate the Joltage requirements, similar to the Buttons extraction, just not nested
+        Position = JoltageAt == std::string_view::npos ? Line.size() : JoltageAt;
+        if(GetEnclosed(Line, '{', '}', Position, Contents))
         {
-            //Similar to the Buttons extraction, just not nested
-
-            std::vector<int> JoltageVector {};
-            std::stringstream Stream (Match[1]);
-
-            while(getline(Stream, SingleIntAsString, ','))
-            {
-                JoltageVector.emplace_back(std::stoi(SingleIntAsString));
-            }
-
-            NewEntry.Joltages = JoltageVector;
+            NumberParsing::ParseList(Contents, NewEntry.Joltages);
         }
 
         //As of now the ManualLine struct "NewEntry" has all its members populated
@@ -340,35 +285,91 @@ int SolveProblemTwo(int& Timed, std::vector<ManualLine>* p_RegexdInputData)
 }
 
 
-int main(int argc, char* argv[])
-{  
-    //Keep track of if this run should be timed or not, default is False
-    int Timed {0};
-    if(argc >= 3){Timed = std::stoi(argv[2]);}
-    if(Timed){PrintTimeNow();}
+struct ParsedInput
+{
+    //The input data processed into neat little objects
+    //ParsedInput itself is made in the run arena, which calls this destructor on release; the lines stay on the heap,
+    //the button searches copy them into plain std containers all the time anyway
+    std::vector<ManualLine>* p_RegexdInputData {nullptr};
+
+    ~ParsedInput()
+    {
+        delete p_RegexdInputData;
+        p_RegexdInputData = nullptr;
+    }
+};
+
+
+ParsedInput* ParseInput(RunOptions& Options, InputLines* p_InputDataVector)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_RegexdInputData = GenerateManualLines(Options.Timed, p_InputDataVector);
 
     //Debugging toggle
-    int Debug {0};
-    if(argc >= 4){Debug = std::stoi(argv[3]);}
-    
-    //The Puzzle Input Data as a POINTER to a vector of strings
-    std::vector<std::string>* p_InputDataVector {GetFileData(argv[1])};
+    if(Options.Debug){PrintInput(p_Parsed->p_RegexdInputData);}
+
+    return p_Parsed;
+}
+
+
+void CompileInput(ParsedInput* p_Parsed, CompiledWriter& Writer)
+{
+    //Per line: the target config, the amount of buttons, every button's lights, then the joltages
+    Writer.Put<std::uint64_t>(p_Parsed->p_RegexdInputData->size());
+
+    for(ManualLine& Entry : *p_Parsed->p_RegexdInputData)
+    {
+        Writer.PutString(Entry.TargetConfig);
+        Writer.Put<std::uint64_t>(Entry.Buttons.size());
+        for(std::vector<int>& Button : Entry.Buttons){Writer.PutArray(Button.data(), Button.size());}
+        Writer.PutArray(Entry.Joltages.data(), Entry.Joltages.size());
+    }
+}
 
-    //Processing the input data into neat little objects
-    std::vector<ManualLine>* p_RegexdInputData {GenerateManualLines(Timed, p_InputDataVector)};
 
-    if(Debug){PrintInput(p_RegexdInputData);}
+ParsedInput* ReloadInput(RunOptions& Options, CompiledReader& Reader)
+{
+    ParsedInput* p_Parsed = Options.p_Arena->Create<ParsedInput>();
+    p_Parsed->p_RegexdInputData = new std::vector<ManualLine>(Reader.Get<std::uint64_t>());
+
+    for(ManualLine& Entry : *p_Parsed->p_RegexdInputData)
+    {
+        Entry.TargetConfig = std::string(Reader.GetString());
+        Entry.Buttons.resize(Reader.Get<std::uint64_t>());
+
+        std::size_t Count {0};
+        for(std::vector<int>& Button : Entry.Buttons)
+        {
+            const int* p_Lights {Reader.GetArray<int>(Count)};
+            Button.assign(p_Lights, p_Lights + Count);
+        }
+
+        const int* p_Joltages {Reader.GetArray<int>(Count)};
+        Entry.Joltages.assign(p_Joltages, p_Joltages + Count);
+
+        if(Reader.Failed){break;}
+    }
+
+    if(Options.Debug){PrintInput(p_Parsed->p_RegexdInputData);}
 
-    std::cout << "Problem One:\n" << SolveProblemOne(Timed, p_RegexdInputData) << std::endl;
-    std::cout << "Problem Two:\n" << SolveProblemTwo(Timed, p_RegexdInputData) << std::endl;
+    return p_Parsed;
+}
+
+
+std::string AnswerProblemOne(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemOne(Options.Timed, p_Parsed->p_RegexdInputData));
+}
+
+
+std::string AnswerProblemTwo(RunOptions& Options, ParsedInput* p_Parsed)
+{
+    return std::to_string(SolveProblemTwo(Options.Timed, p_Parsed->p_RegexdInputData));
+}
 
-    //Cleaning up
-    delete p_InputDataVector;
-    p_InputDataVector = nullptr;
-    delete p_RegexdInputData;
-    p_RegexdInputData = nullptr;
+} //namespace Day10
 
-    std::cout << "\nTotal runtime: " <<  1.0 * clock() /CLOCKS_PER_SEC << "s\n";
 
-    return 0;
-}
\ No newline at end of file
+//Hook this day into the shared runner
+static bool Registered {RegisterDay<Day10::ParsedInput>(10, '\n', Day10::ParseInput, Day10::AnswerProblemOne, Day10::AnswerProblemTwo, 100)};
+static bool RegisteredCompiled {RegisterCompiledDay<Day10::ParsedInput>(10, Day10::CompileInput, Day10::ReloadInput)};
@@ -0,0 +1,150 @@
+/*
+Benchmark for the input loader
+
+    Compares the old per-day GetFileData (std::ifstream + getline into a vector of strings) against the memory mapped
+    line index from InputLoader.h on the same input file
+
+    Every run happens in its own forked child process, that way the peak RSS reported by getrusage belongs to that
+    single loader and is not polluted by an earlier run of the other loader
+
+    Usage: ./LoaderBench <input file> [repetitions] [delimiter]
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "InputLoader.h"
+
+
+struct RunResult
+{
+    double Seconds {0};        //Wall time of the load
+    long PeakRSSKiB {0};       //ru_maxrss of the child that did the load
+    std::size_t Lines {0};     //Sanity check, both loaders should agree
+};
+
+
+std::vector<std::string>* LegacyGetFileData(std::string DataPath, char Delimiter)
+{
+    //Verbatim copy of the loader every day used to carry around
+
+    std::vector<std::string>* p_VectorOfLines = new std::vector<std::string>;
+    std::ifstream FileStream(DataPath);
+    std::string Line;
+
+    if(FileStream.is_open())
+    {
+        while(getline(FileStream, Line, Delimiter))
+        {
+            p_VectorOfLines->emplace_back(Line);
+        }
+    }
+    else
+    {
+        std::cout << "Cannot open file" << std::endl;
+    }
+
+    return p_VectorOfLines;
+}
+
+
+RunResult RunInChild(bool UseLegacy, std::string DataPath, char Delimiter)
+{
+    //Fork, load the file in the child and send the measurements back through a pipe
+
+    RunResult Result {};
+    int Pipe[2];
+    if(pipe(Pipe) != 0){return Result;}
+
+    pid_t ChildID {fork()};
+    if(ChildID == 0)
+    {
+        close(Pipe[0]);
+
+        auto Start {std::chrono::steady_clock::now()};
+        if(UseLegacy)
+        {
+            std::vector<std::string>* p_Lines {LegacyGetFileData(DataPath, Delimiter)};
+            Result.Lines = p_Lines->size();
+            Result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+            delete p_Lines;
+        }
+        else
+        {
+            InputLines* p_Lines {GetFileData(DataPath, Delimiter)};
+            Result.Lines = p_Lines->size();
+            Result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+            delete p_Lines;
+        }
+
+        struct rusage Usage;
+        getrusage(RUSAGE_SELF, &Usage);
+        Result.PeakRSSKiB = Usage.ru_maxrss;
+
+        ssize_t Written {write(Pipe[1], &Result, sizeof(Result))};
+        close(Pipe[1]);
+        _exit(Written == sizeof(Result) ? 0 : 1);
+    }
+
+    close(Pipe[1]);
+    ssize_t Read {read(Pipe[0], &Result, sizeof(Result))};
+    if(Read != sizeof(Result)){Result = RunResult {};}
+    close(Pipe[0]);
+    waitpid(ChildID, nullptr, 0);
+
+    return Result;
+}
+
+
+void Report(std::string Name, std::vector<RunResult>& Results)
+{
+    //Sort on time to grab the min and the median, the peak RSS is the worst seen
+
+    std::sort(Results.begin(), Results.end(), [](const RunResult& A, const RunResult& B){return A.Seconds < B.Seconds;});
+
+    long WorstRSS {0};
+    for(RunResult& Result : Results){WorstRSS = std::max(WorstRSS, Result.PeakRSSKiB);}
+
+    std::cout << Name << "lines: " << Results.front().Lines
+              << "   min: "    << Results.front().Seconds * 1000.0 << "ms"
+              << "   median: " << Results[Results.size() / 2].Seconds * 1000.0 << "ms"
+              << "   peak RSS: " << WorstRSS << "KiB\n";
+}
+
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        std::cout << "Usage: " << argv[0] << " <input file> [repetitions] [delimiter]\n";
+        return 1;
+    }
+
+    int Repetitions {5};
+    if(argc >= 3){Repetitions = std::max(1, std::stoi(argv[2]));}
+
+    char Delimiter {'\n'};
+    if(argc >= 4){Delimiter = argv[3][0];}
+
+    std::vector<RunResult> Legacy {};
+    std::vector<RunResult> Mapped {};
+
+    //Interleave the runs so both loaders see roughly the same page cache state
+    for(int Repetition {0}; Repetition < Repetitions; ++Repetition)
+    {
+        Legacy.emplace_back(RunInChild(true, argv[1], Delimiter));
+        Mapped.emplace_back(RunInChild(false, argv[1], Delimiter));
+    }
+
+    Report("ifstream + getline   ", Legacy);
+    Report("mmap line index      ", Mapped);
+
+    return 0;
+}
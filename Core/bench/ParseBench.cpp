@@ -0,0 +1,200 @@
+/*
+Microbenchmark for the number parsing helpers
+
+    Puts NumberParsing.h up against the ways the days used to pull numbers out of their input:
+
+        stoul       std::stoul(std::string(Field)), what Day 01 and Day 05 did per line
+        stream      std::stringstream + getline + stoul, what Day 02, 05, 09 and 10 did per range, pair or list
+        from_chars  std::from_chars, the allocation free standard library option
+        swar        NumberParsing, 8 digits at a time
+
+    Every case runs over the same pseudo random fields (fixed seed), a checksum of the parsed values is printed next
+    to the timing so a broken parser cannot look fast by accident
+
+    Usage: ./ParseBench [fields] [repetitions]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <charconv>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+
+#include "NumberParsing.h"
+
+
+struct CaseResult
+{
+    double BestSeconds {0};
+    long unsigned int Checksum {0};
+};
+
+
+CaseResult RunCase(std::function<long unsigned int()> Parse, int Repetitions)
+{
+    //Best of N, the minimum is the least noisy estimate for a loop this small
+    CaseResult Result {};
+
+    for(int Repetition {0}; Repetition < Repetitions; ++Repetition)
+    {
+        auto Start {std::chrono::steady_clock::now()};
+        Result.Checksum = Parse();
+        double Seconds {std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count()};
+
+        if(!Repetition || Seconds < Result.BestSeconds){Result.BestSeconds = Seconds;}
+    }
+
+    return Result;
+}
+
+
+void Report(std::string Group, std::string Name, CaseResult Result, std::size_t Fields)
+{
+    std::cout << std::left << std::setw(10) << Group << std::setw(12) << Name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << Result.BestSeconds * 1e9 / Fields << " ns/field"
+              << "   checksum " << Result.Checksum << std::defaultfloat << "\n";
+}
+
+
+std::vector<std::string> MakeFields(std::mt19937_64& Random, std::size_t Count, int MaxDigits, char Separator, int PerField)
+{
+    //PerField numbers of 1 to MaxDigits digits, joined by Separator
+    std::vector<std::string> Fields {};
+    Fields.reserve(Count);
+
+    for(std::size_t i_Field {0}; i_Field < Count; ++i_Field)
+    {
+        std::string Field {};
+        for(int Number {0}; Number < PerField; ++Number)
+        {
+            int Digits {1 + (int)(Random() % MaxDigits)};
+            long unsigned int Limit {1};
+            for(int Digit {0}; Digit < Digits; ++Digit){Limit *= 10;}
+
+            if(Number){Field += Separator;}
+            Field += std::to_string(Random() % Limit);
+        }
+        Fields.emplace_back(Field);
+    }
+
+    return Fields;
+}
+
+
+long unsigned int StreamParse(std::string_view Field, char Separator)
+{
+    std::stringstream StringStream{std::string(Field)};
+    std::string IntAsString;
+    long unsigned int Sum {0};
+    while(getline(StringStream, IntAsString, Separator)){Sum += std::stoul(IntAsString);}
+    return Sum;
+}
+
+
+long unsigned int FromCharsParse(std::string_view Field, char Separator)
+{
+    long unsigned int Sum {0};
+    const char* p_Cursor {Field.data()};
+    const char* p_End {Field.data() + Field.size()};
+    while(p_Cursor < p_End)
+    {
+        long unsigned int Value {0};
+        p_Cursor = std::from_chars(p_Cursor, p_End, Value).ptr + 1;
+        Sum += Value;
+    }
+    return Sum;
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t FieldCount {argc > 1 ? (std::size_t)std::stoul(argv[1]) : 1000000};
+    int Repetitions {argc > 2 ? std::stoi(argv[2]) : 5};
+
+    std::mt19937_64 Random(2025);
+
+    //Day 01 style short numbers, Day 05 style 15 digit IDs
+    for(int MaxDigits : {3, 15})
+    {
+        std::vector<std::string> Fields {MakeFields(Random, FieldCount, MaxDigits, ',', 1)};
+        std::vector<std::string_view> Views(Fields.begin(), Fields.end());
+        std::string Group {"uint<=" + std::to_string(MaxDigits)};
+
+        Report(Group, "stoul", RunCase([&Views]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views){Sum += std::stoul(std::string(Field));}
+            return Sum;
+        }, Repetitions), FieldCount);
+
+        Report(Group, "from_chars", RunCase([&Views]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views){Sum += FromCharsParse(Field, ',');}
+            return Sum;
+        }, Repetitions), FieldCount);
+
+        Report(Group, "swar", RunCase([&Views]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views){Sum += NumberParsing::ToUnsigned<long unsigned int>(Field);}
+            return Sum;
+        }, Repetitions), FieldCount);
+    }
+
+    //Day 02/05 ranges, Day 09 pairs, Day 10 lists
+    struct ShapeCase {std::string Group; int MaxDigits; char Separator; int PerField;};
+    for(ShapeCase Shape : {ShapeCase {"range", 12, '-', 2}, ShapeCase {"pair", 5, ',', 2}, ShapeCase {"list", 3, ',', 6}})
+    {
+        std::vector<std::string> Fields {MakeFields(Random, FieldCount, Shape.MaxDigits, Shape.Separator, Shape.PerField)};
+        std::vector<std::string_view> Views(Fields.begin(), Fields.end());
+        char Separator {Shape.Separator};
+
+        Report(Shape.Group, "stream", RunCase([&Views, Separator]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views){Sum += StreamParse(Field, Separator);}
+            return Sum;
+        }, Repetitions), FieldCount);
+
+        Report(Shape.Group, "from_chars", RunCase([&Views, Separator]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views){Sum += FromCharsParse(Field, Separator);}
+            return Sum;
+        }, Repetitions), FieldCount);
+
+        //The list case reuses one vector, like a day would reuse its container across lines
+        std::vector<long unsigned int> Values {};
+        Report(Shape.Group, "swar", RunCase([&Views, &Values, Shape]()
+        {
+            long unsigned int Sum {0};
+            for(std::string_view Field : Views)
+            {
+                if(Shape.PerField == 2)
+                {
+                    long unsigned int First {0};
+                    long unsigned int Second {0};
+                    if(Shape.Separator == '-'){NumberParsing::ParseRange(Field, First, Second);}
+                    else{NumberParsing::ParsePair(Field, First, Second);}
+                    Sum += First + Second;
+                }
+                else
+                {
+                    Values.clear();
+                    NumberParsing::ParseList(Field, Values);
+                    for(long unsigned int Value : Values){Sum += Value;}
+                }
+            }
+            return Sum;
+        }, Repetitions), FieldCount);
+    }
+
+    return 0;
+}
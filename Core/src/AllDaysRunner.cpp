@@ -0,0 +1,160 @@
+#include "AllDaysRunner.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "SolverRegistry.h"
+#include "Benchmark.h"
+#include "ThreadPool.h"
+#include "ResultCache.h"
+#include "Timing.h"
+
+
+struct DayResult
+{
+    //Everything one day reports back, each task only ever writes to its own entry
+    DaySolver* p_Solver {nullptr};
+    std::string InputPath {};
+    bool HasInput {false};
+    bool FromCache {false};
+    bool OverBudget {false};
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+    std::vector<PhaseRecord> Phases {};
+};
+
+
+std::string GetDayInputPath(std::string Pattern, int Day)
+{
+    std::string DayString {(Day < 10 ? "0" : "") + std::to_string(Day)};
+
+    for(std::size_t Found {Pattern.find("{day}")}; Found != std::string::npos; Found = Pattern.find("{day}", Found))
+    {
+        Pattern.replace(Found, 5, DayString);
+        Found += DayString.size();
+    }
+
+    return Pattern;
+}
+
+
+void PrintAllDaysTable(std::vector<DayResult>& Results, double WallSeconds, int ThreadCount, RunOptions& Options)
+{
+    std::cout << std::left << std::setw(5) << "Day" << std::setw(22) << "Problem One" << std::setw(22) << "Problem Two"
+              << std::right << std::setw(11) << "load (ms)" << std::setw(11) << "parse (ms)"
+              << std::setw(11) << "one (ms)" << std::setw(11) << "two (ms)" << std::setw(12) << "total (ms)";
+    if(Options.Allocations){std::cout << "   heap";}
+    if(Options.Memory){std::cout << "   memory";}
+    if(Options.Counters){std::cout << "   counters";}
+    std::cout << "\n";
+
+    double SumOfDays {0};
+
+    for(DayResult& Result : Results)
+    {
+        std::cout << std::left << std::setw(5) << Result.p_Solver->Day;
+
+        if(Result.OverBudget)
+        {
+            std::cout << "over the memory budget in " << Result.Phases.back().Name << "\n";
+            continue;
+        }
+
+        if(!Result.HasInput)
+        {
+            std::cout << "no input at " << Result.InputPath << "\n";
+            continue;
+        }
+
+        double DayTotal {0};
+        CounterSample DayCounters {};
+        AllocationCounters DayAllocations {};
+        MemoryUsage DayMemory {};
+        for(PhaseRecord& Phase : Result.Phases)
+        {
+            DayTotal += Phase.Seconds;
+            DayCounters.Accumulate(Phase.Counters);
+            DayAllocations.Accumulate(Phase.Allocations);
+            DayMemory.Accumulate(Phase.Memory);
+        }
+        SumOfDays += DayTotal;
+
+        std::cout << std::setw(22) << Result.AnswerOne << std::setw(22) << Result.AnswerTwo
+                  << std::right << std::fixed << std::setprecision(3);
+        for(PhaseRecord& Phase : Result.Phases){std::cout << std::setw(11) << Phase.Seconds * 1000.0;}
+
+        //A cache hit never got to parse or solve
+        for(int i_Missing {(int)Result.Phases.size()}; i_Missing < 4; ++i_Missing){std::cout << std::setw(11) << (Result.FromCache ? "cached" : "-");}
+        std::cout << std::setw(12) << DayTotal * 1000.0 << std::defaultfloat;
+        if(Options.Allocations){std::cout << "   " << DescribeAllocations(DayAllocations);}
+        if(Options.Memory){std::cout << "   " << DescribeMemory(DayMemory);}
+        if(Options.Counters){std::cout << "   " << DescribeCounters(DayCounters);}
+        std::cout << "\n";
+    }
+
+    std::cout << "\nWall time: " << WallSeconds << "s on " << ThreadCount << " thread(s), sum of all days: " << SumOfDays << "s\n";
+
+    std::string CacheDescription {DescribeResultCache()};
+    if(!CacheDescription.empty()){std::cout << CacheDescription << "\n";}
+}
+
+
+int RunAllDays(RunOptions& Options)
+{
+    Stopwatch WallClock {};
+
+    std::vector<DaySolver>& Solvers {GetSolvers()};
+    std::vector<DayResult> Results(Solvers.size());
+
+    //Results stay in day order for the report, the submission order is by expected cost
+    std::vector<int> SubmitOrder {};
+    for(int i_Solver {0}; i_Solver < (int)Solvers.size(); ++i_Solver)
+    {
+        Results[i_Solver].p_Solver = &Solvers[i_Solver];
+        Results[i_Solver].InputPath = GetDayInputPath(Options.InputPath, Solvers[i_Solver].Day);
+        SubmitOrder.emplace_back(i_Solver);
+    }
+    std::stable_sort(SubmitOrder.begin(), SubmitOrder.end(), [&Solvers](int A, int B)
+    {
+        return Solvers[A].ExpectedCost > Solvers[B].ExpectedCost;
+    });
+
+    //Scoped so the pool has joined all its workers before the report is printed
+    int ThreadCount {0};
+    {
+        ThreadPool Pool(Options.Threads);
+        ThreadCount = Pool.GetThreadCount();
+
+        for(int i_Solver : SubmitOrder)
+        {
+            Pool.Submit([&Options, &Results, i_Solver]()
+            {
+                DayResult& Result {Results[i_Solver]};
+
+                RunOptions DayOptions {Options};
+                DayOptions.Day = Result.p_Solver->Day;
+                DayOptions.InputPath = Result.InputPath;
+
+                //Created on the worker thread, so the hardware and allocation counters count this day's thread
+                PhaseRecorder Recorder(DayOptions);
+                DaySolver Solver {SelectEngine(*Result.p_Solver, Options.Engine)};
+                Result.HasInput = RunTimedPhases(Solver, DayOptions, Recorder, Result.AnswerOne, Result.AnswerTwo, &Result.FromCache);
+                Result.OverBudget = Recorder.OverBudget;
+                Result.Phases = Recorder.Records;
+            });
+        }
+
+        Pool.Wait();
+    }
+
+    PrintAllDaysTable(Results, WallClock.Seconds(), ThreadCount, Options);
+
+    for(DayResult& Result : Results)
+    {
+        if(Result.OverBudget){return 1;}
+    }
+
+    return 0;
+}
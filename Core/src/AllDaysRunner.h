@@ -0,0 +1,22 @@
+/*
+All-days runner for the combined ./aoc binary
+
+    Runs every registered day in-process on a work-stealing ThreadPool instead of launching one ./AoC after another
+    Days are submitted in order of their ExpectedCost, so the long tail (Day 09, Day 10) starts straight away
+    and the quick days fill in around it. Total wall time then approaches that of the slowest single day
+
+    Once everything has finished, a single table with every day's answers and phase timings is printed
+*/
+
+#pragma once
+
+#include <string>
+
+#include "CommandLine.h"
+
+
+//Replace every {day} in the pattern with the two digit day number
+std::string GetDayInputPath(std::string Pattern, int Day);
+
+//Run all registered days concurrently and print the consolidated report
+int RunAllDays(RunOptions& Options);
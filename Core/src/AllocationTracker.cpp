@@ -0,0 +1,231 @@
+#include "AllocationTracker.h"
+
+#include <new>
+#include <atomic>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+#include <malloc.h>
+
+#include "MemoryUsage.h"
+
+
+namespace
+{
+    //Plain thread_local PODs, zero initialised without any dynamic initialisation, so safe to touch from operator new
+    thread_local AllocationCounters ThreadCounters {};
+    std::atomic<bool> TrackingEnabled {false};
+
+    //Only kept up to date while there is a budget, one shared counter is not free on every new and delete
+    std::atomic<std::int64_t> BudgetBytes {0};
+    std::atomic<std::int64_t> ProcessLiveBytes {0};
+
+
+    //In front of every block, so a delete knows what its new counted and takes exactly that back off again
+    struct alignas(16) BlockHeader
+    {
+        std::int64_t Size;          //As malloc actually sized the block, header included
+        std::uint32_t Offset;       //From the start of what malloc handed out to the block itself
+        bool Budgeted;              //Counted in ProcessLiveBytes
+        bool Tracked;               //Counted in the thread counters
+    };
+
+
+    BlockHeader* GetBlockHeader(void* p_Memory)
+    {
+        return (BlockHeader*)p_Memory - 1;
+    }
+
+
+    void* CountAllocation(void* p_Raw, std::uint32_t Offset)
+    {
+        void* p_Memory {(char*)p_Raw + Offset};
+        BlockHeader* p_Header {GetBlockHeader(p_Memory)};
+        p_Header->Offset = Offset;
+        p_Header->Budgeted = false;
+        p_Header->Tracked = false;
+
+        std::int64_t Budget {BudgetBytes.load(std::memory_order_relaxed)};
+        bool Tracking {TrackingEnabled.load(std::memory_order_relaxed)};
+        if(!Budget && !Tracking){return p_Memory;}
+
+        std::int64_t Size {(std::int64_t)malloc_usable_size(p_Raw)};
+        p_Header->Size = Size;
+
+        if(Budget)
+        {
+            std::int64_t Live {ProcessLiveBytes.fetch_add(Size, std::memory_order_relaxed)};
+            if(Live + Size > Budget)
+            {
+                ProcessLiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+                std::free(p_Raw);
+                throw MemoryBudgetExceeded((std::size_t)Size, Live);
+            }
+            p_Header->Budgeted = true;
+        }
+
+        if(!Tracking){return p_Memory;}
+        p_Header->Tracked = true;
+
+        ++ThreadCounters.Allocations;
+        ThreadCounters.BytesAllocated += Size;
+        ThreadCounters.LiveBytes += Size;
+        if(ThreadCounters.LiveBytes > ThreadCounters.PeakLiveBytes){ThreadCounters.PeakLiveBytes = ThreadCounters.LiveBytes;}
+
+        return p_Memory;
+    }
+
+
+    void CheckBudget(std::size_t Size)
+    {
+        //A request that cannot fit is turned down before malloc, which might not even manage that much and throw
+        //a plain std::bad_alloc the runners do not report
+        std::int64_t Budget {BudgetBytes.load(std::memory_order_relaxed)};
+        if(!Budget){return;}
+
+        std::int64_t Live {ProcessLiveBytes.load(std::memory_order_relaxed)};
+        if(Size > (std::size_t)std::max<std::int64_t>(0, Budget - Live)){throw MemoryBudgetExceeded(Size, Live);}
+    }
+
+
+    void* Allocate(std::size_t Size)
+    {
+        CheckBudget(Size);
+
+        //operator new may never return nullptr, and new(0) still has to hand out a unique pointer
+        //Close to SIZE_MAX the header would wrap the size around to a tiny block
+        if(Size > SIZE_MAX - sizeof(BlockHeader)){throw std::bad_alloc();}
+        void* p_Raw {std::malloc(sizeof(BlockHeader) + Size)};
+        if(!p_Raw){throw std::bad_alloc();}
+
+        //Frees the memory again and throws if it does not fit in the budget
+        return CountAllocation(p_Raw, sizeof(BlockHeader));
+    }
+
+
+    void* AllocateAligned(std::size_t Size, std::align_val_t Alignment)
+    {
+        //The header goes in the padding in front of the block, which takes up a whole alignment
+        std::size_t Padding {std::max(sizeof(BlockHeader), (std::size_t)Alignment)};
+        CheckBudget(Size);
+        if(Size > SIZE_MAX - Padding){throw std::bad_alloc();}
+
+        void* p_Raw {nullptr};
+        if(posix_memalign(&p_Raw, Padding, Padding + Size) != 0){throw std::bad_alloc();}
+
+        return CountAllocation(p_Raw, (std::uint32_t)Padding);
+    }
+
+
+    void Deallocate(void* p_Memory)
+    {
+        if(!p_Memory){return;}
+
+        //Blocks from before the budget or the tracking was switched on were never counted, so are not taken off either
+        BlockHeader* p_Header {GetBlockHeader(p_Memory)};
+        if(p_Header->Budgeted){ProcessLiveBytes.fetch_sub(p_Header->Size, std::memory_order_relaxed);}
+        if(p_Header->Tracked)
+        {
+            ++ThreadCounters.Deallocations;
+            ThreadCounters.LiveBytes -= p_Header->Size;
+        }
+
+        std::free((char*)p_Memory - p_Header->Offset);
+    }
+}
+
+
+void AllocationCounters::Accumulate(const AllocationCounters& Other)
+{
+    Allocations += Other.Allocations;
+    Deallocations += Other.Deallocations;
+    BytesAllocated += Other.BytesAllocated;
+    LiveBytes += Other.LiveBytes;
+    PeakLiveBytes = std::max(PeakLiveBytes, Other.PeakLiveBytes);
+}
+
+
+void EnableAllocationTracking()
+{
+    TrackingEnabled.store(true);
+}
+
+
+bool AllocationTrackingEnabled()
+{
+    return TrackingEnabled.load(std::memory_order_relaxed);
+}
+
+
+void SetMemoryBudget(std::int64_t Bytes)
+{
+    BudgetBytes.store(std::max<std::int64_t>(0, Bytes));
+}
+
+
+std::int64_t GetMemoryBudget()
+{
+    return BudgetBytes.load(std::memory_order_relaxed);
+}
+
+
+AllocationCounters GetThreadAllocationCounters()
+{
+    return ThreadCounters;
+}
+
+
+void ResetThreadAllocationPeak()
+{
+    ThreadCounters.PeakLiveBytes = ThreadCounters.LiveBytes;
+}
+
+
+AllocationCounters GetAllocationDelta(const AllocationCounters& Before, const AllocationCounters& After)
+{
+    AllocationCounters Delta {};
+    Delta.Allocations = After.Allocations - Before.Allocations;
+    Delta.Deallocations = After.Deallocations - Before.Deallocations;
+    Delta.BytesAllocated = After.BytesAllocated - Before.BytesAllocated;
+    Delta.LiveBytes = After.LiveBytes - Before.LiveBytes;
+    Delta.PeakLiveBytes = std::max<std::int64_t>(0, After.PeakLiveBytes - Before.LiveBytes);
+
+    return Delta;
+}
+
+
+std::string DescribeAllocations(const AllocationCounters& Counters)
+{
+    std::ostringstream Description;
+    Description << "allocs " << Counters.Allocations << "  bytes " << DescribeBytes((double)Counters.BytesAllocated)
+                << "  peak " << DescribeBytes((double)Counters.PeakLiveBytes);
+
+    return Description.str();
+}
+
+
+//The replacements themselves, every standard form of operator new and delete
+
+void* operator new(std::size_t Size) {return Allocate(Size);}
+void* operator new[](std::size_t Size) {return Allocate(Size);}
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept
+{
+    try {return Allocate(Size);} catch(...) {return nullptr;}
+}
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept
+{
+    try {return Allocate(Size);} catch(...) {return nullptr;}
+}
+void* operator new(std::size_t Size, std::align_val_t Alignment) {return AllocateAligned(Size, Alignment);}
+void* operator new[](std::size_t Size, std::align_val_t Alignment) {return AllocateAligned(Size, Alignment);}
+
+void operator delete(void* p_Memory) noexcept {Deallocate(p_Memory);}
+void operator delete[](void* p_Memory) noexcept {Deallocate(p_Memory);}
+void operator delete(void* p_Memory, std::size_t) noexcept {Deallocate(p_Memory);}
+void operator delete[](void* p_Memory, std::size_t) noexcept {Deallocate(p_Memory);}
+void operator delete(void* p_Memory, const std::nothrow_t&) noexcept {Deallocate(p_Memory);}
+void operator delete[](void* p_Memory, const std::nothrow_t&) noexcept {Deallocate(p_Memory);}
+void operator delete(void* p_Memory, std::align_val_t) noexcept {Deallocate(p_Memory);}
+void operator delete[](void* p_Memory, std::align_val_t) noexcept {Deallocate(p_Memory);}
+void operator delete(void* p_Memory, std::size_t, std::align_val_t) noexcept {Deallocate(p_Memory);}
+void operator delete[](void* p_Memory, std::size_t, std::align_val_t) noexcept {Deallocate(p_Memory);}
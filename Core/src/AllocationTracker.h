@@ -0,0 +1,74 @@
+/*
+Heap allocation accounting (--allocations)
+
+    This translation unit replaces the global operator new/delete (every form of it), so every heap allocation in the
+    process goes through a couple of counters before being handed on to malloc/free:
+
+        Allocations       how many times new was called
+        Deallocations     how many times delete was called
+        BytesAllocated    total bytes handed out (as malloc actually sized them)
+        LiveBytes         bytes currently allocated
+        PeakLiveBytes     high water mark of LiveBytes
+
+    Counting only starts once EnableAllocationTracking has been called, until then new/delete cost one extra branch
+    The counters are per thread, so days running side by side in the all-days runner do not mix up their numbers
+
+    SetMemoryBudget (--memory-budget=MB) puts a cap on the heap of the whole process: once the live bytes would go over
+    it, operator new throws MemoryBudgetExceeded instead of letting a day run the machine out of memory. The runners
+    catch it, report where it happened and give up on that run, rather than having the process OOM killed
+    Only allocations made after the budget is set count towards it, and only freeing those gives any of it back
+
+    Every block carries a 16 byte header (a whole alignment for over-aligned ones) saying what its new counted
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <string>
+
+
+struct AllocationCounters
+{
+    std::uint64_t Allocations {0};
+    std::uint64_t Deallocations {0};
+    std::uint64_t BytesAllocated {0};
+    std::int64_t LiveBytes {0};
+    std::int64_t PeakLiveBytes {0};
+
+    //Add another set of counters on top of this one, used to total up phases and repetitions
+    void Accumulate(const AllocationCounters& Other);
+};
+
+
+void EnableAllocationTracking();
+bool AllocationTrackingEnabled();
+
+//Counters of the calling thread
+AllocationCounters GetThreadAllocationCounters();
+
+//Start a fresh high water mark for the calling thread, at whatever is live right now
+void ResetThreadAllocationPeak();
+
+//Counters accumulated between two snapshots, the peak is relative to what was live at the first one
+AllocationCounters GetAllocationDelta(const AllocationCounters& Before, const AllocationCounters& After);
+
+struct MemoryBudgetExceeded : std::bad_alloc
+{
+    MemoryBudgetExceeded(std::size_t Requested, std::int64_t Live) : RequestedBytes {Requested}, LiveBytes {Live} {}
+
+    const char* what() const noexcept override {return "memory budget exceeded";}
+
+    std::size_t RequestedBytes {0};
+    std::int64_t LiveBytes {0};         //Heap live in the whole process when the request came in
+};
+
+
+//Cap the live heap of the whole process at Bytes, 0 lifts the cap
+void SetMemoryBudget(std::int64_t Bytes);
+std::int64_t GetMemoryBudget();
+
+
+//Short "allocs 1234  bytes 5.6 MiB  peak 1.2 MiB" summary
+std::string DescribeAllocations(const AllocationCounters& Counters);
@@ -0,0 +1,228 @@
+#include "BatchRunner.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+
+#include "Benchmark.h"
+#include "BoundedQueue.h"
+#include "PhaseRecorder.h"
+#include "ThreadPool.h"
+#include "Timing.h"
+
+
+struct BatchItem
+{
+    //One prefetched input on its way from the reader to a worker
+    int Index {0};
+    std::string InputPath {};
+    bool HasInput {false};
+    bool OverBudget {false};           //Loading it already went over the memory budget
+    LoadedInput Loaded {};
+    PhaseRecord LoadRecord {};
+};
+
+
+struct BatchTotals
+{
+    int Solved {0};
+    int Cached {0};
+    int NoInput {0};
+    int Failed {0};
+    int OverBudget {0};
+};
+
+
+std::vector<std::string> GetBatchInputs(std::string Path)
+{
+    std::vector<std::string> Inputs {};
+    std::error_code Error {};
+
+    if(std::filesystem::is_directory(Path, Error))
+    {
+        for(const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Path, Error))
+        {
+            if(Entry.is_regular_file(Error)){Inputs.emplace_back(Entry.path().string());}
+        }
+        std::sort(Inputs.begin(), Inputs.end());
+    }
+    else
+    {
+        std::ifstream Manifest(Path);
+        if(!Manifest.is_open())
+        {
+            std::cout << "Cannot open batch " << Path << ", expected a directory or a manifest file" << std::endl;
+            return Inputs;
+        }
+
+        std::filesystem::path ManifestDirectory {std::filesystem::path(Path).parent_path()};
+        std::string Line {};
+        while(std::getline(Manifest, Line))
+        {
+            //Tolerate Windows line endings and indentation
+            Line.erase(0, Line.find_first_not_of(" \t"));
+            Line.erase(Line.find_last_not_of(" \t\r") + 1);
+            if(Line.empty() || Line.front() == '#'){continue;}
+
+            std::filesystem::path InputPath {Line};
+            if(InputPath.is_relative()){InputPath = ManifestDirectory / InputPath;}
+            Inputs.emplace_back(InputPath.string());
+        }
+    }
+
+    if(Inputs.empty()){std::cout << "No inputs found in batch " << Path << std::endl;}
+
+    return Inputs;
+}
+
+
+std::string GetBatchRecord(DaySolver& Solver, RunOptions& Options, BatchItem& Item, const char* Status, std::vector<PhaseRecord>& SolvePhases,
+                           std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //Same conventions as the benchmark JSON, times in integral nanoseconds, phases that never ran are left out
+    std::ostringstream Record;
+    Record << "{\"index\":" << Item.Index
+           << ",\"input\":\"" << EscapeJson(Item.InputPath) << "\""
+           << ",\"day\":" << Solver.Day
+           << ",\"status\":\"" << Status << "\""
+           << ",\"cached\":" << (Item.Loaded.CacheHit ? "true" : "false");
+
+    if(Status == std::string("ok"))
+    {
+        Record << ",\"answers\":[\"" << EscapeJson(AnswerOne) << "\",\"" << EscapeJson(AnswerTwo) << "\"]";
+    }
+
+    Record << ",\"" << Item.LoadRecord.Name << "_ns\":" << (long long)(Item.LoadRecord.Seconds * 1e9);
+    for(PhaseRecord& Phase : SolvePhases){Record << ",\"" << Phase.Name << "_ns\":" << (long long)(Phase.Seconds * 1e9);}
+
+    //Process wide, other inputs being solved at the same time are in there too
+    if(Options.Memory)
+    {
+        std::int64_t PeakResident {Item.LoadRecord.Memory.PeakResidentBytes};
+        for(PhaseRecord& Phase : SolvePhases){PeakResident = std::max(PeakResident, Phase.Memory.PeakResidentBytes);}
+        Record << ",\"peak_rss_bytes\":" << PeakResident;
+    }
+    Record << "}";
+
+    return Record.str();
+}
+
+
+int RunBatch(DaySolver& Solver, RunOptions& Options)
+{
+    std::vector<std::string> Inputs {GetBatchInputs(Options.BatchPath)};
+    if(Inputs.empty()){return 1;}
+
+    std::ofstream JsonFile {};
+    if(Options.Json && !Options.JsonPath.empty())
+    {
+        JsonFile.open(Options.JsonPath, std::ios::app);
+        if(!JsonFile.is_open())
+        {
+            std::cout << "Cannot open " << Options.JsonPath << " for writing" << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& Output {JsonFile.is_open() ? (std::ostream&)JsonFile : std::cout};
+
+    int WorkerCount {Options.Threads > 0 ? Options.Threads : std::max(1, (int)std::thread::hardware_concurrency())};
+    int Prefetch {Options.Prefetch > 0 ? Options.Prefetch : 2 * WorkerCount};
+
+    BoundedQueue<BatchItem> Queue(Prefetch);
+    std::mutex OutputLock;
+    BatchTotals Totals {};
+
+    Stopwatch WallClock {};
+
+    //Scoped so every worker has joined before the summary is printed
+    {
+        //One extra thread for the reader, it spends most of its time blocked on a full queue
+        ThreadPool Pool(WorkerCount + 1);
+
+        Pool.Submit([&Solver, &Options, &Inputs, &Queue]()
+        {
+            PhaseRecorder Recorder(Options);
+
+            for(int i_Input {0}; i_Input < (int)Inputs.size(); ++i_Input)
+            {
+                RunOptions InputOptions {Options};
+                InputOptions.InputPath = Inputs[i_Input];
+
+                BatchItem Item {};
+                Item.Index = i_Input;
+                Item.InputPath = Inputs[i_Input];
+
+                Recorder.Reset();
+                Item.HasInput = RunLoadPhase(Solver, InputOptions, Recorder, Item.Loaded);
+                Item.OverBudget = Recorder.OverBudget;
+                Item.LoadRecord = Recorder.Records.front();
+
+                if(!Queue.Push(std::move(Item))){break;}
+            }
+
+            Queue.Close();
+        });
+
+        for(int Worker {0}; Worker < WorkerCount; ++Worker)
+        {
+            Pool.Submit([&Solver, &Options, &Queue, &OutputLock, &Output, &Totals]()
+            {
+                //Created on the worker thread, so the hardware and allocation counters count this worker
+                PhaseRecorder Recorder(Options);
+                BatchItem Item {};
+
+                //Reused for every input this worker solves, it soon fits the largest one
+                RunArena Arena {};
+
+                while(Queue.Pop(Item))
+                {
+                    RunOptions InputOptions {Options};
+                    InputOptions.InputPath = Item.InputPath;
+                    InputOptions.p_Arena = &Arena;
+
+                    std::string AnswerOne {};
+                    std::string AnswerTwo {};
+                    const char* Status {Item.OverBudget ? "over_budget" : "no_input"};
+
+                    Recorder.Reset();
+                    if(Item.HasInput)
+                    {
+                        bool Solved {RunSolvePhases(Solver, InputOptions, Recorder, Item.Loaded, AnswerOne, AnswerTwo)};
+                        Status = Solved ? "ok" : Recorder.OverBudget ? "over_budget" : "failed";
+                    }
+
+                    std::string Record {GetBatchRecord(Solver, Options, Item, Status, Recorder.Records, AnswerOne, AnswerTwo)};
+
+                    std::lock_guard<std::mutex> Guard(OutputLock);
+                    Output << Record << "\n";
+                    Output.flush();
+
+                    if(Status == std::string("over_budget")){++Totals.OverBudget;}
+                    else if(!Item.HasInput){++Totals.NoInput;}
+                    else if(Status == std::string("failed")){++Totals.Failed;}
+                    else if(Item.Loaded.CacheHit){++Totals.Cached;}
+                    else{++Totals.Solved;}
+                }
+            });
+        }
+
+        Pool.Wait();
+    }
+
+    double WallSeconds {WallClock.Seconds()};
+
+    std::cout << "Batch: " << Inputs.size() << " input(s) in " << std::fixed << std::setprecision(3) << WallSeconds << "s on "
+              << WorkerCount << " worker(s), prefetch " << Prefetch << ": " << std::setprecision(1) << Inputs.size() / WallSeconds
+              << " inputs/s" << std::defaultfloat << " (" << Totals.Solved << " solved, " << Totals.Cached << " cached, "
+              << Totals.NoInput << " without input, " << Totals.Failed << " failed, " << Totals.OverBudget << " over the memory budget)" << std::endl;
+
+    std::string CacheDescription {DescribeResultCache()};
+    if(!CacheDescription.empty()){std::cout << CacheDescription << std::endl;}
+
+    return Totals.NoInput || Totals.Failed || Totals.OverBudget ? 1 : 0;
+}
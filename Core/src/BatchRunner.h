@@ -0,0 +1,41 @@
+/*
+Batch mode for validating many inputs of one day in a single process (--batch=PATH)
+
+    Running ./AoC once per input pays for process startup, iostream setup and a cold cache every single time
+    Batch mode solves a whole set of inputs in one go instead:
+
+        ./aoc --day=5 --batch=variants/             every regular file in the directory, in name order
+        ./aoc --day=5 --batch=variants.txt          a manifest, one input path per line, blank lines and # comments
+                                                    are skipped, relative paths are relative to the manifest
+
+    One reader thread maps, indexes and hashes the inputs ahead of the workers and hands them over through a
+    BoundedQueue, so the next input is already in memory while the current ones are being solved, but never more
+    than --prefetch=N of them (defaults to twice the number of workers)
+    --threads=N workers pop inputs off the queue and parse and solve them
+
+    Every input produces one JSON record as soon as it is done, in completion order, on stdout or appended to
+    --json=FILE:
+
+        {"index":3,"input":"variants/x.txt","day":5,"status":"ok","cached":false,"answers":["3","14"],
+         "load_ns":41000,"parse_ns":95000,"part_one_ns":3000,"part_two_ns":2000}
+
+    status is one of ok, no_input, failed or over_budget (--memory-budget=MB), --memory adds the peak_rss_bytes of the
+    process while the input was being loaded and solved
+
+    The run ends with a summary line giving the throughput in inputs per second
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+
+
+//The inputs named by --batch=PATH, a directory or a manifest file, empty (and reported) if there are none
+std::vector<std::string> GetBatchInputs(std::string Path);
+
+//Solve every input of the batch with one day and stream out a record per input
+int RunBatch(DaySolver& Solver, RunOptions& Options);
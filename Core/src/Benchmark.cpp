@@ -0,0 +1,366 @@
+#include "Benchmark.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+#include "InputLoader.h"
+#include "Timing.h"
+#include "ResultCache.h"
+#include "CompiledInput.h"
+
+
+const char* PhaseNames[4] {"load", "parse", "part_one", "part_two"};
+
+
+bool RunLoadPhase(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, LoadedInput& Loaded)
+{
+    //Same as RunSolver, hashing the input and looking it up in the cache is part of loading it
+    Loaded.UseCache = Options.Cache != CacheBypass;
+
+    try
+    {
+        Recorder.Begin(PhaseNames[0]);
+        Loaded.p_InputData = LoadSolverInput(Solver, Options, Loaded.Compiled);
+        if(Loaded.UseCache && (Loaded.Compiled || !Loaded.p_InputData->empty()))
+        {
+            Loaded.CacheKey = GetResultCacheKey(Solver.Day, Solver.Version, Solver.Engine, Loaded.p_InputData);
+            Loaded.CacheHit = Options.Cache == CacheUse && LoadCachedResult(Options, Loaded.CacheKey, Loaded.CachedOne, Loaded.CachedTwo);
+        }
+        Recorder.End();
+    }
+    catch(MemoryBudgetExceeded& Exceeded)
+    {
+        Recorder.Abandon(Exceeded);
+        delete Loaded.p_InputData;
+        Loaded.p_InputData = nullptr;
+        return false;
+    }
+
+    if(!Loaded.Compiled && Loaded.p_InputData->empty())
+    {
+        delete Loaded.p_InputData;
+        Loaded.p_InputData = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool RunSolvePhases(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, LoadedInput& Loaded,
+                    std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //A cache hit only ever records the load phase
+    if(Loaded.CacheHit)
+    {
+        AnswerOne = Loaded.CachedOne;
+        AnswerTwo = Loaded.CachedTwo;
+        delete Loaded.p_InputData;
+        Loaded.p_InputData = nullptr;
+        return true;
+    }
+
+    //The solvers' own PrintTimeNow markers and debug output would swamp the measurements, switch them off
+    RunOptions QuietOptions {Options};
+    QuietOptions.Timed = 0;
+    QuietOptions.Debug = 0;
+
+    //Callers that run over and over pass in their own arena, so it can settle on the size of a run
+    RunArena LocalArena(Options.p_Arena ? 1 : 64 * 1024);
+    RunArena* p_Arena {Options.p_Arena ? Options.p_Arena : &LocalArena};
+    QuietOptions.p_Arena = p_Arena;
+
+    std::shared_ptr<void> p_Parsed {};
+
+    try
+    {
+        Recorder.Begin(PhaseNames[1]);
+        p_Parsed = ParseSolverInput(Solver, QuietOptions, Loaded.p_InputData, Loaded.Compiled);
+        Recorder.End();
+
+        if(!p_Parsed)
+        {
+            p_Arena->Release();
+            delete Loaded.p_InputData;
+            Loaded.p_InputData = nullptr;
+            return false;
+        }
+
+        Recorder.Begin(PhaseNames[2]);
+        AnswerOne = Solver.SolveOne(QuietOptions, p_Parsed.get());
+        Recorder.End();
+
+        Recorder.Begin(PhaseNames[3]);
+        AnswerTwo = Solver.SolveTwo(QuietOptions, p_Parsed.get());
+        Recorder.End();
+    }
+    catch(MemoryBudgetExceeded& Exceeded)
+    {
+        //The day's locals are gone with the unwinding, whatever it built in the arena goes here
+        Recorder.Abandon(Exceeded);
+        p_Parsed.reset();
+        p_Arena->Release(false);
+        delete Loaded.p_InputData;
+        Loaded.p_InputData = nullptr;
+        return false;
+    }
+
+    if(Loaded.UseCache && Options.Cache == CacheVerify){VerifyCachedResult(Options, Loaded.CacheKey, AnswerOne, AnswerTwo);}
+    else if(Loaded.UseCache){StoreCachedResult(Options, Loaded.CacheKey, AnswerOne, AnswerTwo);}
+
+    //Tearing down is not part of any phase
+    p_Parsed.reset();
+    p_Arena->Release();
+    delete Loaded.p_InputData;
+    Loaded.p_InputData = nullptr;
+
+    return true;
+}
+
+
+bool RunTimedPhases(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, std::string& AnswerOne, std::string& AnswerTwo,
+                    bool* p_FromCache)
+{
+    LoadedInput Loaded {};
+    if(!RunLoadPhase(Solver, Options, Recorder, Loaded)){return false;}
+
+    if(p_FromCache){*p_FromCache = Loaded.CacheHit;}
+
+    return RunSolvePhases(Solver, Options, Recorder, Loaded, AnswerOne, AnswerTwo);
+}
+
+
+PhaseStatistics GetPhaseStatistics(std::vector<double> Samples)
+{
+    PhaseStatistics Statistics {};
+    if(Samples.empty()){return Statistics;}
+
+    std::sort(Samples.begin(), Samples.end());
+
+    //Nearest rank: the smallest sample that at least P percent of the samples are at or below
+    auto Percentile = [&Samples](double Percent)
+    {
+        int Rank {(int)std::ceil(Percent / 100.0 * Samples.size())};
+        return Samples[std::clamp(Rank - 1, 0, (int)Samples.size() - 1)];
+    };
+
+    double Total {0};
+    for(double Sample : Samples){Total += Sample;}
+
+    Statistics.Min    = Samples.front();
+    Statistics.Median = Percentile(50);
+    Statistics.P99    = Percentile(99);
+    Statistics.Mean   = Total / Samples.size();
+
+    return Statistics;
+}
+
+
+AllocationCounters GetAllocationsPerRepetition(PhaseTimings& Phase, int Repetitions)
+{
+    //Counts and bytes are averaged, the peak already is a maximum over the repetitions
+    AllocationCounters PerRepetition {Phase.AllocationTotals};
+    Repetitions = std::max(1, Repetitions);
+    PerRepetition.Allocations /= Repetitions;
+    PerRepetition.Deallocations /= Repetitions;
+    PerRepetition.BytesAllocated /= Repetitions;
+    PerRepetition.LiveBytes /= Repetitions;
+
+    return PerRepetition;
+}
+
+
+MemoryUsage GetMemoryPerRepetition(PhaseTimings& Phase, int Repetitions)
+{
+    //Resident growth is averaged, the peak already is a maximum over the repetitions
+    MemoryUsage PerRepetition {Phase.MemoryTotals};
+    PerRepetition.ResidentBytes /= std::max(1, Repetitions);
+
+    return PerRepetition;
+}
+
+
+void PrintBenchmarkTable(DaySolver& Solver, RunOptions& Options, std::vector<PhaseTimings>& Phases)
+{
+    std::cout << "Day " << Solver.Day << " benchmark: " << Options.BenchRepetitions << " repetitions after "
+              << Options.WarmupRuns << " warm-up runs\n";
+    std::cout << std::left << std::setw(12) << "Phase"
+              << std::right << std::setw(14) << "min (ms)" << std::setw(14) << "median (ms)"
+              << std::setw(14) << "p99 (ms)" << std::setw(14) << "mean (ms)";
+    if(Options.Allocations){std::cout << "   heap per repetition";}
+    if(Options.Memory){std::cout << "   memory per repetition";}
+    if(Options.Counters){std::cout << "   counters";}
+    std::cout << "\n";
+
+    for(PhaseTimings& Phase : Phases)
+    {
+        PhaseStatistics Statistics {GetPhaseStatistics(Phase.Seconds)};
+
+        std::cout << std::left << std::setw(12) << Phase.Name << std::right << std::fixed << std::setprecision(4)
+                  << std::setw(14) << Statistics.Min * 1000.0
+                  << std::setw(14) << Statistics.Median * 1000.0
+                  << std::setw(14) << Statistics.P99 * 1000.0
+                  << std::setw(14) << Statistics.Mean * 1000.0;
+        if(Options.Allocations){std::cout << "   " << DescribeAllocations(GetAllocationsPerRepetition(Phase, Options.BenchRepetitions));}
+        if(Options.Memory){std::cout << "   " << DescribeMemory(GetMemoryPerRepetition(Phase, Options.BenchRepetitions));}
+        if(Options.Counters){std::cout << "   " << DescribeCounters(Phase.CounterTotals);}
+        std::cout << "\n";
+    }
+    std::cout << std::defaultfloat;
+}
+
+
+std::string EscapeJson(std::string Text)
+{
+    //Only quotes, backslashes and control characters need care for the strings that end up in here
+    std::string Escaped {};
+    for(char Character : Text)
+    {
+        if(Character == '"' || Character == '\\'){Escaped += '\\'; Escaped += Character;}
+        else if((unsigned char)Character < 0x20){Escaped += ' ';}
+        else{Escaped += Character;}
+    }
+    return Escaped;
+}
+
+
+std::string GetBenchmarkJson(DaySolver& Solver, RunOptions& Options, std::vector<PhaseTimings>& Phases,
+                             std::string& AnswerOne, std::string& AnswerTwo)
+{
+    //One self contained object per run, easy to append to a log and diff across commits
+    //All times are in nanoseconds to keep them integral
+
+    std::ostringstream Json;
+    Json << "{\"day\":" << Solver.Day
+         << ",\"input\":\"" << EscapeJson(Options.InputPath) << "\""
+         << ",\"timestamp\":" << std::time(nullptr)
+         << ",\"repetitions\":" << Options.BenchRepetitions
+         << ",\"warmup\":" << Options.WarmupRuns
+         << ",\"answers\":[\"" << EscapeJson(AnswerOne) << "\",\"" << EscapeJson(AnswerTwo) << "\"]"
+         << ",\"phases\":[";
+
+    for(int i_Phase {0}; i_Phase < (int)Phases.size(); ++i_Phase)
+    {
+        PhaseStatistics Statistics {GetPhaseStatistics(Phases[i_Phase].Seconds)};
+
+        if(i_Phase){Json << ",";}
+        Json << "{\"name\":\"" << Phases[i_Phase].Name << "\""
+             << ",\"min_ns\":"    << (long long)(Statistics.Min * 1e9)
+             << ",\"median_ns\":" << (long long)(Statistics.Median * 1e9)
+             << ",\"p99_ns\":"    << (long long)(Statistics.P99 * 1e9)
+             << ",\"mean_ns\":"   << (long long)(Statistics.Mean * 1e9);
+
+        //Hardware counters as the mean per repetition, only the ones that were actually counted
+        const char* CounterNames[CounterKinds] {"cycles", "instructions", "l1d_misses", "llc_misses", "branches", "branch_misses"};
+        CounterSample& Counters {Phases[i_Phase].CounterTotals};
+        bool FirstCounter {true};
+        for(int Kind {0}; Kind < CounterKinds; ++Kind)
+        {
+            if(!Counters.Valid[Kind]){continue;}
+            Json << (FirstCounter ? ",\"counters\":{" : ",") << "\"" << CounterNames[Kind] << "\":"
+                 << (long long)(Counters.Values[Kind] / std::max(1, Options.BenchRepetitions));
+            FirstCounter = false;
+        }
+        if(!FirstCounter){Json << "}";}
+
+        //Heap traffic, also per repetition
+        if(Options.Allocations)
+        {
+            AllocationCounters Allocations {GetAllocationsPerRepetition(Phases[i_Phase], Options.BenchRepetitions)};
+            Json << ",\"allocations\":{\"count\":" << Allocations.Allocations
+                 << ",\"bytes\":" << Allocations.BytesAllocated
+                 << ",\"peak_live_bytes\":" << Allocations.PeakLiveBytes << "}";
+        }
+
+        //Resident memory, growth per repetition and the peak over all of them
+        if(Options.Memory)
+        {
+            MemoryUsage Memory {GetMemoryPerRepetition(Phases[i_Phase], Options.BenchRepetitions)};
+            Json << ",\"memory\":{\"rss_delta_bytes\":" << Memory.ResidentBytes
+                 << ",\"peak_rss_bytes\":" << Memory.PeakResidentBytes << "}";
+        }
+
+        Json << "}";
+    }
+    Json << "]}";
+
+    return Json.str();
+}
+
+
+int RunBenchmark(DaySolver& Solver, RunOptions& Options)
+{
+    std::vector<PhaseTimings> Phases {};
+    for(const char* Name : PhaseNames){Phases.emplace_back(PhaseTimings {Name, {}});}
+    for(PhaseTimings& Phase : Phases){Phase.Seconds.reserve(Options.BenchRepetitions);}
+
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+
+    //Every repetition has to actually solve, a cached answer would make for a very flattering benchmark
+    RunOptions BenchOptions {Options};
+    BenchOptions.Cache = CacheBypass;
+
+    //One arena for all repetitions, after the first one it has grown to fit and stays off the heap
+    RunArena Arena {};
+    BenchOptions.p_Arena = &Arena;
+
+    PhaseRecorder Recorder(Options);
+
+    for(int Repetition {0}; Repetition < Options.WarmupRuns + Options.BenchRepetitions; ++Repetition)
+    {
+        Recorder.Reset();
+
+        if(!RunTimedPhases(Solver, BenchOptions, Recorder, AnswerOne, AnswerTwo))
+        {
+            //Going over the memory budget has already been reported
+            if(!Recorder.OverBudget){std::cout << "No input to process" << std::endl;}
+            return 1;
+        }
+
+        if(Repetition >= Options.WarmupRuns)
+        {
+            for(int i_Phase {0}; i_Phase < 4; ++i_Phase)
+            {
+                Phases[i_Phase].Seconds.emplace_back(Recorder.Records[i_Phase].Seconds);
+                Phases[i_Phase].CounterTotals.Accumulate(Recorder.Records[i_Phase].Counters);
+                Phases[i_Phase].AllocationTotals.Accumulate(Recorder.Records[i_Phase].Allocations);
+                Phases[i_Phase].MemoryTotals.Accumulate(Recorder.Records[i_Phase].Memory);
+            }
+        }
+    }
+
+    if(!Options.Json)
+    {
+        std::cout << "Problem One:\n" << AnswerOne << "\n";
+        std::cout << "Problem Two:\n" << AnswerTwo << "\n\n";
+        PrintBenchmarkTable(Solver, Options, Phases);
+        return 0;
+    }
+
+    std::string Json {GetBenchmarkJson(Solver, Options, Phases, AnswerOne, AnswerTwo)};
+
+    if(Options.JsonPath.empty())
+    {
+        std::cout << Json << std::endl;
+        return 0;
+    }
+
+    //Append, so a file can collect the history of many runs (one JSON object per line)
+    std::ofstream JsonFile(Options.JsonPath, std::ios::app);
+    if(!JsonFile.is_open())
+    {
+        std::cout << "Cannot open file " << Options.JsonPath << std::endl;
+        return 1;
+    }
+    JsonFile << Json << "\n";
+
+    PrintBenchmarkTable(Solver, Options, Phases);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+Benchmark mode for all Advent of Code 2025 C++ projects
+
+    Runs the full pipeline of a day over and over, timing each phase on its own with steady_clock:
+
+        Load        GetFileData, mapping and indexing the input
+        Parse       The day's ParseInput (i.e. GetRangesAsMap, GenerateManualLines)
+        Part One    AnswerProblemOne
+        Part Two    AnswerProblemTwo
+
+    Every repetition starts from a fresh load, Day 04 for example edits its grid during problem two
+    Days that answer both problems in one pass (06, 07) show all of that work under Part One
+
+    The first WarmupRuns repetitions are thrown away, after that min/median/p99/mean are reported per phase
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+#include "PhaseRecorder.h"
+#include "ResultCache.h"
+
+
+struct PhaseTimings
+{
+    std::string Name {};
+    std::vector<double> Seconds {};     //One sample per measured repetition
+    CounterSample CounterTotals {};     //Hardware counters summed over all measured repetitions (--counters)
+    AllocationCounters AllocationTotals {};     //Heap traffic summed over all measured repetitions (--allocations)
+    MemoryUsage MemoryTotals {};        //Resident growth summed, and the highest peak, over all measured repetitions (--memory)
+};
+
+
+struct PhaseStatistics
+{
+    double Min {0};
+    double Median {0};
+    double P99 {0};
+    double Mean {0};
+};
+
+
+struct LoadedInput
+{
+    //What the load phase hands over to the other three, the input is released again by RunSolvePhases
+    InputLines* p_InputData {nullptr};
+    bool Compiled {false};
+    bool UseCache {false};
+    bool CacheHit {false};
+    ResultCacheKey CacheKey {};
+    std::string CachedOne {};
+    std::string CachedTwo {};
+};
+
+
+//Names of the four phases, in the order RunTimedPhases fills them in
+extern const char* PhaseNames[4];
+
+//The two halves of RunTimedPhases, for callers that load on one thread and solve on another (batch mode)
+//RunLoadPhase returns false if there was no input, RunSolvePhases false if a compiled input turned out to be corrupt
+bool RunLoadPhase(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, LoadedInput& Loaded);
+bool RunSolvePhases(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, LoadedInput& Loaded,
+                    std::string& AnswerOne, std::string& AnswerTwo);
+
+//Load, parse and solve once, recording each phase in the Recorder
+//The solvers' own timing and debug output is switched off, returns false if there was no input
+bool RunTimedPhases(DaySolver& Solver, RunOptions& Options, PhaseRecorder& Recorder, std::string& AnswerOne, std::string& AnswerTwo,
+                    bool* p_FromCache = nullptr);
+
+//Summarise a set of samples, the percentiles use the nearest rank method
+PhaseStatistics GetPhaseStatistics(std::vector<double> Samples);
+
+//Make Text safe to put between double quotes in a JSON document
+std::string EscapeJson(std::string Text);
+
+//Run the benchmark for a single day and print (or write) the report
+int RunBenchmark(DaySolver& Solver, RunOptions& Options);
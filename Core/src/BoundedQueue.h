@@ -0,0 +1,63 @@
+/*
+Blocking producer/consumer queue with a fixed capacity
+
+    Push blocks while the queue is full, Pop blocks while it is empty, so a fast producer can never run further
+    ahead of its consumers than Capacity items
+    Close wakes everyone up: Push fails from then on, Pop keeps handing out what is left and fails once it is drained
+*/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+
+template<typename Item>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(std::size_t Capacity) : Capacity {Capacity ? Capacity : 1} {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    bool Push(Item NewItem)
+    {
+        std::unique_lock<std::mutex> Guard(Lock);
+        NotFull.wait(Guard, [this]{return Closed || Items.size() < Capacity;});
+        if(Closed){return false;}
+
+        Items.emplace_back(std::move(NewItem));
+        NotEmpty.notify_one();
+        return true;
+    }
+
+    bool Pop(Item& NextItem)
+    {
+        std::unique_lock<std::mutex> Guard(Lock);
+        NotEmpty.wait(Guard, [this]{return Closed || !Items.empty();});
+        if(Items.empty()){return false;}
+
+        NextItem = std::move(Items.front());
+        Items.pop_front();
+        NotFull.notify_one();
+        return true;
+    }
+
+    void Close()
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        Closed = true;
+        NotFull.notify_all();
+        NotEmpty.notify_all();
+    }
+
+private:
+    std::mutex Lock;
+    std::condition_variable NotFull;
+    std::condition_variable NotEmpty;
+    std::deque<Item> Items {};
+    std::size_t Capacity {1};
+    bool Closed {false};
+};
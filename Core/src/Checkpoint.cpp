@@ -0,0 +1,167 @@
+#include "Checkpoint.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <unistd.h>
+
+#include "ResultCache.h"
+#include "RunArena.h"
+#include "Timing.h"
+
+
+namespace
+{
+    const char* CheckpointMagic {"aoc-checkpoint 1"};
+}
+
+
+std::uint64_t GetCheckpointTailHash(const char* p_Data, std::uint64_t Offset)
+{
+    std::uint64_t TailSize {std::min<std::uint64_t>(Offset, CheckpointTailSize)};
+    return HashBytes(p_Data + Offset - TailSize, TailSize);
+}
+
+
+bool LoadCheckpoint(const std::string& Path, Checkpoint& Saved)
+{
+    //Layout: magic, then day, version, offset and tail hash, then the state as its length in bytes and the state itself
+    std::ifstream File(Path, std::ios::binary);
+    if(!File.is_open()){return false;}
+
+    std::string Magic {};
+    std::getline(File, Magic);
+    if(Magic != CheckpointMagic){return false;}
+
+    File >> Saved.Day >> Saved.Version >> Saved.Offset >> std::hex >> Saved.TailHash >> std::dec;
+
+    std::size_t Length {0};
+    File >> Length;
+    File.get();     //The single separator after the length
+    if(!File){return false;}
+
+    Saved.State.resize(Length);
+    File.read(Saved.State.data(), Length);
+
+    return (std::size_t)File.gcount() == Length;
+}
+
+
+bool StoreCheckpoint(const std::string& Path, const Checkpoint& Saved)
+{
+    //Unique per process, a second run on the same checkpoint at the same time writes its own temporary file
+    std::ostringstream TemporaryPath;
+    TemporaryPath << Path << ".tmp." << getpid();
+
+    {
+        std::ofstream File(TemporaryPath.str(), std::ios::binary | std::ios::trunc);
+        if(File.is_open())
+        {
+            File << CheckpointMagic << "\n" << Saved.Day << " " << Saved.Version << " " << Saved.Offset << " "
+                 << std::hex << Saved.TailHash << std::dec << "\n" << Saved.State.size() << "\n" << Saved.State << "\n";
+        }
+
+        if(!File.is_open() || !File.good())
+        {
+            std::cout << "Cannot write checkpoint " << Path << " (" << std::strerror(errno) << ")" << std::endl;
+            std::remove(TemporaryPath.str().c_str());
+            return false;
+        }
+    }
+
+    if(std::rename(TemporaryPath.str().c_str(), Path.c_str()) != 0)
+    {
+        std::cout << "Cannot write checkpoint " << Path << " (" << std::strerror(errno) << ")" << std::endl;
+        std::remove(TemporaryPath.str().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+
+int RunCheckpointedSolver(DaySolver& Solver, RunOptions& Options)
+{
+    Stopwatch TotalRuntime {};
+
+    if(!Solver.Resume)
+    {
+        std::cout << "Day " << Solver.Day << " cannot resume from a checkpoint, it needs the whole input every time" << std::endl;
+        return 1;
+    }
+
+    if(Options.Timed){PrintTimeNow();}
+
+    std::string CheckpointPath {Options.CheckpointPath.empty() ? Options.InputPath + ".checkpoint" : Options.CheckpointPath};
+
+    //Mapping is free, only the pages after the checkpoint are ever read
+    InputLines* p_InputData {MapFile(Options.InputPath)};
+    if(!p_InputData->p_Data)
+    {
+        std::cout << "No input to process" << std::endl;
+        delete p_InputData;
+        return 1;
+    }
+    const char* p_Data {p_InputData->p_Data};
+    std::uint64_t DataSize {p_InputData->DataSize};
+
+    Checkpoint Saved {};
+    bool Resumed {LoadCheckpoint(CheckpointPath, Saved) && Saved.Day == Solver.Day && Saved.Version == Solver.Version
+                  && Saved.Offset <= DataSize && Saved.TailHash == GetCheckpointTailHash(p_Data, Saved.Offset)};
+
+    std::string State {Resumed ? Saved.State : ""};
+    std::uint64_t Start {Resumed ? Saved.Offset : 0};
+    std::size_t Used {0};
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+
+    //Anything the day builds on the way lives in the arena, like in a normal run
+    RunArena Arena {};
+    RunOptions ArenaOptions {Options};
+    ArenaOptions.p_Arena = &Arena;
+
+    bool Solved {Solver.Resume(ArenaOptions, std::string_view(p_Data + Start, DataSize - Start), State, Used, AnswerOne, AnswerTwo)};
+    if(!Solved && Resumed)
+    {
+        //The day did not accept its own saved state, start over from the top
+        Resumed = false;
+        Start = 0;
+        State.clear();
+        Arena.Release();
+        Solved = Solver.Resume(ArenaOptions, std::string_view(p_Data, DataSize), State, Used, AnswerOne, AnswerTwo);
+    }
+
+    Arena.Release();
+
+    if(!Solved)
+    {
+        delete p_InputData;
+        return 1;
+    }
+
+    Checkpoint Updated {};
+    Updated.Day = Solver.Day;
+    Updated.Version = Solver.Version;
+    Updated.Offset = Start + Used;
+    Updated.TailHash = GetCheckpointTailHash(p_Data, Updated.Offset);
+    Updated.State = State;
+
+    delete p_InputData;
+    p_InputData = nullptr;
+
+    std::cout << "Problem One:\n" << AnswerOne << "\n";
+    std::cout << "Problem Two:\n" << AnswerTwo << "\n";
+
+    bool Stored {StoreCheckpoint(CheckpointPath, Updated)};
+
+    std::cout << "\nCheckpoint: " << (Resumed ? "resumed at byte " + std::to_string(Start) : std::string("started from the top"))
+              << ", read " << DataSize - Start << " byte(s), now at byte " << Updated.Offset << " of " << DataSize << "\n";
+
+    std::cout << "\nTotal runtime: " << TotalRuntime.Seconds() << "s\n";
+
+    return Stored ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+/*
+Picking up where the last run left off on inputs that only ever grow (--checkpoint[=FILE])
+
+    An input that keeps being appended to, like a log, does not have to be solved from the top on every run
+    Days that can carry their answers forward register a resume entry point, which starts from a saved state and
+    only reads the bytes that were added since:
+
+        ./aoc --day=1 rotations.log --checkpoint        solves all of it, writes rotations.log.checkpoint
+        ./aoc --day=1 rotations.log --checkpoint        later on, only reads what was appended in between
+
+    The checkpoint holds how far into the input the day got, the day's state at that point, and a hash of the last
+    (up to) CheckpointTailSize bytes before it. An input shorter than that, or with different bytes there, was replaced
+    rather than appended to, and the day starts over from the top. So does a checkpoint from another day or solver version
+
+    Only complete lines go into a checkpoint: a last line without its newline may still be in the middle of being
+    written, it counts towards the answers printed now, but is read again next time
+    Written to a temporary file and renamed into place, same as the result cache, the input itself is never touched
+*/
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+
+
+constexpr std::size_t CheckpointTailSize {4096};
+
+
+struct Checkpoint
+{
+    int Day {0};
+    int Version {0};
+    std::uint64_t Offset {0};       //Bytes of the input the state covers, always right after a newline
+    std::uint64_t TailHash {0};     //HashBytes over the CheckpointTailSize bytes before Offset, fewer near the start
+    std::string State {};           //Whatever the day's resume entry point saved, opaque to everything else
+};
+
+
+//Hash of the bytes a checkpoint at Offset ends on
+std::uint64_t GetCheckpointTailHash(const char* p_Data, std::uint64_t Offset);
+
+//False if there is no checkpoint at Path or it cannot be read
+bool LoadCheckpoint(const std::string& Path, Checkpoint& Saved);
+
+//False, with a message, if it cannot be written
+bool StoreCheckpoint(const std::string& Path, const Checkpoint& Saved);
+
+//Resume the day from its checkpoint (or from scratch), print the answers and move the checkpoint up to the new end
+int RunCheckpointedSolver(DaySolver& Solver, RunOptions& Options);
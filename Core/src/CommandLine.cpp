@@ -0,0 +1,156 @@
+#include "CommandLine.h"
+
+#include <iostream>
+#include <vector>
+
+
+bool ParseCommandLine(int argc, char* argv[], RunOptions& Options)
+{
+    //Split the arguments into --named options and plain positional ones
+    std::vector<std::string> Positional {};
+
+    for(int i_Argument {1}; i_Argument < argc; ++i_Argument)
+    {
+        std::string Argument {argv[i_Argument]};
+
+        if(Argument.rfind("--day=", 0) == 0)
+        {
+            Options.Day = std::stoi(Argument.substr(6));
+        }
+        else if(Argument == "--timed")
+        {
+            Options.Timed = 1;
+        }
+        else if(Argument == "--debug")
+        {
+            Options.Debug = 1;
+        }
+        else if(Argument == "--stream")
+        {
+            Options.Streaming = true;
+        }
+        else if(Argument == "--checkpoint" || Argument.rfind("--checkpoint=", 0) == 0)
+        {
+            Options.Checkpoint = true;
+            if(Argument.size() > 13){Options.CheckpointPath = Argument.substr(13);}
+        }
+        else if(Argument.rfind("--queries=", 0) == 0)
+        {
+            Options.Queries = Argument.substr(10);
+        }
+        else if(Argument == "--counters")
+        {
+            Options.Counters = true;
+        }
+        else if(Argument == "--allocations")
+        {
+            Options.Allocations = true;
+        }
+        else if(Argument == "--memory")
+        {
+            Options.Memory = true;
+        }
+        else if(Argument.rfind("--memory-budget=", 0) == 0)
+        {
+            Options.MemoryBudget = std::stoll(Argument.substr(16)) * 1024 * 1024;
+        }
+        else if(Argument.rfind("--trace=", 0) == 0)
+        {
+            Options.TracePath = Argument.substr(8);
+        }
+        else if(Argument.rfind("--engine=", 0) == 0)
+        {
+            std::string Engine {Argument.substr(9)};
+            if(Engine == "fast"){Options.Engine = EngineFast;}
+            else if(Engine == "reference"){Options.Engine = EngineReference;}
+            else if(Engine == "both"){Options.Engine = EngineBoth;}
+            else
+            {
+                std::cout << "Unknown engine: " << Engine << ", expected fast, reference or both" << std::endl;
+                return false;
+            }
+        }
+        else if(Argument == "--no-cache")
+        {
+            Options.Cache = CacheBypass;
+        }
+        else if(Argument == "--verify-cache")
+        {
+            Options.Cache = CacheVerify;
+        }
+        else if(Argument.rfind("--cache-dir=", 0) == 0)
+        {
+            Options.CacheDir = Argument.substr(12);
+        }
+        else if(Argument == "--compile-input" || Argument.rfind("--compile-input=", 0) == 0)
+        {
+            Options.CompileInput = true;
+            if(Argument.size() > 16){Options.CompiledPath = Argument.substr(16);}
+        }
+        else if(Argument == "--all")
+        {
+            Options.AllDays = true;
+        }
+        else if(Argument.rfind("--threads=", 0) == 0)
+        {
+            Options.Threads = std::stoi(Argument.substr(10));
+        }
+        else if(Argument.rfind("--day-threads=", 0) == 0)
+        {
+            Options.DayThreads = std::stoi(Argument.substr(14));
+        }
+        else if(Argument.rfind("--batch=", 0) == 0)
+        {
+            Options.BatchPath = Argument.substr(8);
+        }
+        else if(Argument.rfind("--prefetch=", 0) == 0)
+        {
+            Options.Prefetch = std::stoi(Argument.substr(11));
+        }
+        else if(Argument.rfind("--bench=", 0) == 0)
+        {
+            Options.BenchRepetitions = std::stoi(Argument.substr(8));
+        }
+        else if(Argument.rfind("--warmup=", 0) == 0)
+        {
+            Options.WarmupRuns = std::stoi(Argument.substr(9));
+        }
+        else if(Argument == "--json" || Argument.rfind("--json=", 0) == 0)
+        {
+            Options.Json = true;
+            if(Argument.size() > 7){Options.JsonPath = Argument.substr(7);}
+        }
+        else if(Argument.rfind("--", 0) == 0)
+        {
+            std::cout << "Unknown option: " << Argument << std::endl;
+            return false;
+        }
+        else
+        {
+            Positional.emplace_back(Argument);
+        }
+    }
+
+    //The positional arguments follow the original <input file> [timed] [debug] layout
+    if(Positional.size() >= 1){Options.InputPath = Positional[0];}
+    if(Positional.size() >= 2){Options.Timed = std::stoi(Positional[1]);}
+    if(Positional.size() >= 3){Options.Debug = std::stoi(Positional[2]);}
+
+    if(Options.AllDays && Options.InputPath.empty()){Options.InputPath = "2025 {day}/input.txt";}
+
+    if(Options.Streaming && Options.InputPath.empty()){Options.InputPath = "-";}
+
+    if(Options.AllDays && Options.Engine == EngineBoth)
+    {
+        std::cout << "--engine=both compares one day at a time, use --day=N with --batch=PATH for many inputs" << std::endl;
+        return false;
+    }
+
+    if(Options.InputPath.empty() && Options.BatchPath.empty())
+    {
+        std::cout << "Usage: " << argv[0] << " [--day=N | --all [--threads=N]] [--day-threads=N] [--batch=PATH [--prefetch=N]] [--timed] [--debug] [--stream] [--checkpoint[=FILE]] [--queries=LIST] [--counters] [--allocations] [--memory] [--memory-budget=MB] [--trace=FILE] [--engine=fast|reference|both] [--no-cache | --verify-cache] [--cache-dir=DIR] [--compile-input[=FILE]] [--bench=N [--warmup=N] [--json[=FILE]]] <input file> [timed] [debug]" << std::endl;
+        return false;
+    }
+
+    return true;
+}
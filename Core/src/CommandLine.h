@@ -0,0 +1,118 @@
+/*
+Shared command line parsing for all Advent of Code 2025 C++ projects
+
+    The old per-day invocation keeps working as is:
+
+        ./AoC <input file> [timed] [debug]
+
+    On top of that, named options can be given in any order:
+
+        --day=N        Which registered day to run, only needed when more than one day is linked in (./aoc)
+        --timed        Same as passing 1 for [timed]
+        --debug        Same as passing 1 for [debug]
+        --all          Run every registered day concurrently, <input file> becomes a pattern where {day} is
+                       replaced by the two digit day number, defaults to "2025 {day}/input.txt"
+        --threads=N    Worker threads for --all and --batch, defaults to one per hardware thread
+        --day-threads=N
+                       Threads a day may split a single input over, for days that can (01), 0 for one per hardware
+                       thread; defaults to 1, as --all and --batch already keep every core busy with whole inputs
+        --batch=PATH   Solve every input in a directory, or listed in a manifest file, with the one day, streaming out
+                       a JSON record per input (to --json=FILE if given) and the throughput at the end (BatchRunner.h)
+        --prefetch=N   Inputs --batch loads ahead of the workers, defaults to twice the number of workers
+        --stream       Read the input in fixed size chunks and feed it line by line to days that support it
+                       (01, 03, 05, 07), <input file> may be "-" or left out to read from stdin
+        --checkpoint[=FILE]
+                       For inputs that only ever grow: continue from the checkpoint in FILE (defaults to
+                       <input file>.checkpoint) with just the bytes appended since, then move it up (Checkpoint.h)
+        --queries=LIST Answer variations of the puzzle the input does not pin down, all in one pass over the input, for
+                       days that take them (01: comma separated start/positions pairs, the puzzle is 50/100,
+                       03: comma separated digit counts, the puzzle is 2,12)
+        --counters     Count cycles, instructions, cache and branch misses per phase with perf_event_open
+        --allocations  Count heap allocations, bytes allocated and peak live bytes per phase
+        --memory       Report resident memory growth and peak resident memory per phase (MemoryUsage.h)
+        --memory-budget=MB
+                       Cap the heap at MB MiB, a day that goes over it is stopped with a report of where it happened
+                       instead of taking the machine down with it
+        --trace=FILE   Record every phase as a span on its thread's timeline and write them to FILE as a Chrome
+                       trace, to open in Perfetto or chrome://tracing (Trace.h)
+        --engine=E     fast (default), reference or both: days keep their original algorithm as the reference engine
+                       next to any optimised one, both runs the two on the same inputs (--batch for many) and reports
+                       mismatching answers and the speedup
+        --no-cache     Always parse and solve, do not look at or store in the result cache
+        --verify-cache Parse and solve, then report any difference with the cached answers and replace them
+        --cache-dir=D  Where the result cache lives, defaults to ./.aoc_cache
+        --compile-input[=FILE]
+                       Parse the input and write it in the day's pre-parsed binary form to FILE, defaults to
+                       <input file>.bin; any run accepts such a file in place of the text input (CompiledInput.h)
+        --bench=N      Benchmark mode, run every phase N times and report min/median/p99 wall time
+        --warmup=N     Untimed runs before the benchmark starts measuring, defaults to 3
+        --json[=FILE]  Write the benchmark report as JSON to FILE, or to stdout without a FILE
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+
+class RunArena;
+
+
+enum SolverEngine
+{
+    EngineFast,         //The day's fast engine, or its reference engine if it has no other
+    EngineReference,    //Always the day's original implementation
+    EngineBoth          //Run both on every input, compare the answers and the time they took (EngineComparison.h)
+};
+
+
+enum CacheMode
+{
+    CacheUse,           //Answer from the cache on a hit, store on a miss
+    CacheBypass,        //Leave the cache alone
+    CacheVerify         //Always solve, compare with the cache, then store
+};
+
+
+struct RunOptions
+{
+    int Day {-1};                  //-1 means "whichever day is registered", only valid if there is exactly one
+    std::string InputPath {};
+    int Timed {0};
+    int Debug {0};
+
+    bool Streaming {false};
+    std::string Queries {};        //Empty means the puzzle as asked
+    bool Checkpoint {false};
+    std::string CheckpointPath {}; //Empty means <input file>.checkpoint
+    bool Counters {false};
+    bool Allocations {false};
+    bool Memory {false};
+    std::int64_t MemoryBudget {0};     //In bytes, 0 means no budget
+    std::string TracePath {};      //Empty means no tracing
+    bool AllDays {false};
+    int Threads {0};               //0 means one per hardware thread
+    int DayThreads {1};            //Within one day's solve, 0 means one per hardware thread
+
+    std::string BatchPath {};      //Empty means no batch
+    int Prefetch {0};              //0 means twice the number of workers
+
+    bool CompileInput {false};
+    std::string CompiledPath {};   //Empty means <input file>.bin
+
+    SolverEngine Engine {EngineFast};
+
+    CacheMode Cache {CacheUse};
+    std::string CacheDir {".aoc_cache"};
+
+    RunArena* p_Arena {nullptr};   //Where the day builds its data for this run, set by the runners (RunArena.h)
+
+    int BenchRepetitions {0};      //0 means a normal run
+    int WarmupRuns {3};
+    bool Json {false};
+    std::string JsonPath {};       //Empty means stdout
+};
+
+
+//Turn argv into RunOptions, prints a message and returns false if the arguments make no sense
+bool ParseCommandLine(int argc, char* argv[], RunOptions& Options);
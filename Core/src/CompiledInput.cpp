@@ -0,0 +1,135 @@
+#include "CompiledInput.h"
+
+#include <iostream>
+#include <fstream>
+
+
+namespace
+{
+    const CompiledHeader* GetHeader(InputLines* p_InputData)
+    {
+        //The mapping is page aligned, so the header can be read in place
+        return (const CompiledHeader*)p_InputData->p_Data;
+    }
+}
+
+
+bool IsCompiledInput(InputLines* p_InputData)
+{
+    CompiledHeader Expected {};
+    return p_InputData->p_Data && p_InputData->DataSize >= sizeof(CompiledHeader) &&
+           std::memcmp(p_InputData->p_Data, Expected.Magic, sizeof(Expected.Magic)) == 0;
+}
+
+
+InputLines* LoadSolverInput(DaySolver& Solver, RunOptions& Options, bool& Compiled)
+{
+    InputLines* p_InputData {MapFile(Options.InputPath)};
+    Compiled = IsCompiledInput(p_InputData);
+
+    if(!Compiled)
+    {
+        //Engines that walk the raw bytes themselves get the mapping as one line, indexing it would only cost time
+        if(p_InputData->p_Data && Solver.WholeInput){p_InputData->Lines.emplace_back(p_InputData->p_Data, p_InputData->DataSize);}
+        else if(p_InputData->p_Data){IndexLines(p_InputData, Solver.Delimiter);}
+        return p_InputData;
+    }
+
+    //Anything wrong with the header is reported here, the caller then sees an empty input
+    const CompiledHeader* p_Header {GetHeader(p_InputData)};
+    std::string Problem {};
+
+    if(p_Header->FormatVersion != CompiledHeader {}.FormatVersion){Problem = "unknown format version " + std::to_string(p_Header->FormatVersion);}
+    else if((int)p_Header->Day != Solver.Day){Problem = "it was compiled for day " + std::to_string(p_Header->Day);}
+    else if(!Solver.Reload){Problem = "this day cannot read compiled inputs";}
+    else if((int)p_Header->SolverVersion != Solver.Version){Problem = "it was compiled by solver version " + std::to_string(p_Header->SolverVersion) + ", recompile it";}
+    else if(p_Header->PayloadSize > p_InputData->DataSize - sizeof(CompiledHeader)){Problem = "it is truncated";}
+
+    if(!Problem.empty())
+    {
+        std::cout << "Cannot use compiled input " << Options.InputPath << " for day " << Solver.Day << ": " << Problem << std::endl;
+        delete p_InputData;
+        p_InputData = new InputLines;
+        Compiled = false;
+    }
+
+    return p_InputData;
+}
+
+
+std::shared_ptr<void> ParseSolverInput(DaySolver& Solver, RunOptions& Options, InputLines* p_InputData, bool Compiled)
+{
+    if(!Compiled){return Solver.Parse(Options, p_InputData);}
+
+    CompiledReader Reader(p_InputData->p_Data + sizeof(CompiledHeader), GetHeader(p_InputData)->PayloadSize);
+    std::shared_ptr<void> p_Parsed {Solver.Reload(Options, Reader)};
+
+    if(Reader.Failed)
+    {
+        std::cout << "Compiled input " << Options.InputPath << " is corrupt" << std::endl;
+        return nullptr;
+    }
+
+    return p_Parsed;
+}
+
+
+int CompileSolverInput(DaySolver& Solver, RunOptions& Options)
+{
+    if(!Solver.Compile)
+    {
+        std::cout << "Day " << Solver.Day << " has no compiled input format" << std::endl;
+        return 1;
+    }
+
+    InputLines* p_InputData {GetFileData(Options.InputPath, Solver.Delimiter)};
+    if(p_InputData->empty())
+    {
+        std::cout << "No input to process" << std::endl;
+        delete p_InputData;
+        return 1;
+    }
+
+    //Quiet parse, the point is the data, not the day's progress output
+    RunOptions QuietOptions {Options};
+    QuietOptions.Timed = 0;
+    QuietOptions.Debug = 0;
+
+    RunArena Arena {};
+    QuietOptions.p_Arena = &Arena;
+
+    std::shared_ptr<void> p_Parsed {Solver.Parse(QuietOptions, p_InputData)};
+
+    CompiledWriter Writer {};
+    Solver.Compile(p_Parsed.get(), Writer);
+
+    p_Parsed.reset();
+    Arena.Release();
+    delete p_InputData;
+    p_InputData = nullptr;
+
+    CompiledHeader Header {};
+    Header.Day = Solver.Day;
+    Header.SolverVersion = Solver.Version;
+    Header.PayloadSize = Writer.Bytes.size();
+
+    std::string OutputPath {Options.CompiledPath.empty() ? Options.InputPath + ".bin" : Options.CompiledPath};
+    std::ofstream Output(OutputPath, std::ios::binary | std::ios::trunc);
+    if(!Output.is_open())
+    {
+        std::cout << "Cannot open file " << OutputPath << std::endl;
+        return 1;
+    }
+
+    Output.write((const char*)&Header, sizeof(Header));
+    Output.write(Writer.Bytes.data(), Writer.Bytes.size());
+    if(!Output.good())
+    {
+        std::cout << "Cannot write file " << OutputPath << std::endl;
+        return 1;
+    }
+
+    std::cout << "Compiled day " << Solver.Day << " input into " << OutputPath << " (" << sizeof(Header) + Writer.Bytes.size() << " bytes)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+Pre-parsed binary inputs (--compile-input)
+
+    Some days spend most of their time turning text into numbers and containers. For inputs that get solved over and
+    over, that work can be done once up front:
+
+        ./aoc --day=10 input.txt --compile-input            writes input.txt.bin
+        ./aoc --day=10 input.txt.bin                        no text parsing, the day rebuilds its data from the blob
+
+    A compiled file is recognised by its header, any runner accepts it in place of the text input:
+
+        Offset  Size  Field
+        0       8     Magic "AOC25BIN"
+        8       4     FormatVersion, the layout of this header
+        12      4     Day
+        16      4     Solver version the payload was written by, see DaySolver::Version
+        20      4     Reserved, 0
+        24      8     PayloadSize in bytes
+        32            Payload, laid out however the day's Compile function likes
+
+    The whole file is mapped in one go like any other input, arrays in the payload are 8 byte aligned so a day can
+    point straight into the mapping instead of copying them out
+    A payload written by another solver version is rejected, days bump their Version when their layout changes
+
+    Days opt in from the bottom of their source file, after RegisterDay:
+
+        static bool RegisteredCompiled {RegisterCompiledDay<Day10::ParsedInput>(10, Day10::CompileInput, Day10::ReloadInput)};
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "InputLoader.h"
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+
+
+struct CompiledHeader
+{
+    char Magic[8] {'A', 'O', 'C', '2', '5', 'B', 'I', 'N'};
+    std::uint32_t FormatVersion {1};
+    std::uint32_t Day {0};
+    std::uint32_t SolverVersion {0};
+    std::uint32_t Reserved {0};
+    std::uint64_t PayloadSize {0};
+};
+
+
+struct CompiledWriter
+{
+    //Appends plain values and arrays to a byte buffer, mirrored by CompiledReader
+    std::string Bytes {};
+
+    template<typename Value>
+    void Put(Value Item)
+    {
+        static_assert(std::is_trivially_copyable_v<Value>, "Only plain values can be written");
+        Bytes.append((const char*)&Item, sizeof(Value));
+    }
+
+    template<typename Value>
+    void PutArray(const Value* p_Items, std::size_t Count)
+    {
+        //Count first, then the items starting on an 8 byte boundary, so the reader can hand out a pointer to them
+        static_assert(std::is_trivially_copyable_v<Value>, "Only plain values can be written");
+        Put<std::uint64_t>(Count);
+        Align();
+        Bytes.append((const char*)p_Items, Count * sizeof(Value));
+        Align();
+    }
+
+    void PutString(std::string_view Text) {PutArray(Text.data(), Text.size());}
+
+    void Align() {Bytes.append((8 - Bytes.size() % 8) % 8, '\0');}
+};
+
+
+struct CompiledReader
+{
+    //Reads a payload back, every Get is bounds checked, after the first failure everything reads as empty
+    CompiledReader(const char* p_Payload, std::size_t PayloadSize) : p_Begin {p_Payload}, p_Cursor {p_Payload}, p_End {p_Payload + PayloadSize} {}
+
+    template<typename Value>
+    Value Get()
+    {
+        Value Item {};
+        if(Failed || (std::size_t)(p_End - p_Cursor) < sizeof(Value)){Failed = true; return Item;}
+
+        std::memcpy(&Item, p_Cursor, sizeof(Value));
+        p_Cursor += sizeof(Value);
+        return Item;
+    }
+
+    template<typename Value>
+    const Value* GetArray(std::size_t& Count)
+    {
+        //Points into the payload, valid for as long as the mapping is
+        Count = Get<std::uint64_t>();
+        Align();
+        if(Failed || (std::size_t)(p_End - p_Cursor) / sizeof(Value) < Count){Failed = true; Count = 0; return nullptr;}
+
+        const Value* p_Items {(const Value*)p_Cursor};
+        p_Cursor += Count * sizeof(Value);
+        Align();
+        return p_Items;
+    }
+
+    std::string_view GetString()
+    {
+        std::size_t Length {0};
+        const char* p_Characters {GetArray<char>(Length)};
+        return std::string_view(p_Characters ? p_Characters : "", Length);
+    }
+
+    void Align()
+    {
+        std::size_t Padding {(8 - (std::size_t)(p_Cursor - p_Begin) % 8) % 8};
+        if((std::size_t)(p_End - p_Cursor) < Padding){Failed = true; return;}
+        p_Cursor += Padding;
+    }
+
+    const char* p_Begin {nullptr};
+    const char* p_Cursor {nullptr};
+    const char* p_End {nullptr};
+    bool Failed {false};
+};
+
+
+template<typename ParsedData>
+bool RegisterCompiledDay(int Day, void (*Compile)(ParsedData*, CompiledWriter&), ParsedData* (*Reload)(RunOptions&, CompiledReader&))
+{
+    //Attach the compile and reload entry points to an already registered day, same idea as RegisterStreamingDay
+    DaySolver* p_Solver {FindSolver(Day)};
+    if(!p_Solver){return false;}
+
+    p_Solver->Compile = [Compile](void* p_Parsed, CompiledWriter& Writer)
+    {
+        Compile((ParsedData*)p_Parsed, Writer);
+    };
+    p_Solver->Reload = [Reload](RunOptions& Options, CompiledReader& Reader)
+    {
+        return std::shared_ptr<void>(Reload(Options, Reader), [](ParsedData*){});
+    };
+
+    return true;
+}
+
+
+//True if the mapped file starts with a compiled input header
+bool IsCompiledInput(InputLines* p_InputData);
+
+//Map the input for Solver, indexing its lines unless it is a compiled input for this day
+//A compiled input the day cannot read (other day, other version, no reload support) is reported and comes back empty
+InputLines* LoadSolverInput(DaySolver& Solver, RunOptions& Options, bool& Compiled);
+
+//Parse the text input, or rebuild the parsed data straight from a compiled one
+std::shared_ptr<void> ParseSolverInput(DaySolver& Solver, RunOptions& Options, InputLines* p_InputData, bool Compiled);
+
+//--compile-input: parse the text input and write the day's compiled form next to it (or to Options.CompiledPath)
+int CompileSolverInput(DaySolver& Solver, RunOptions& Options);
@@ -0,0 +1,121 @@
+#include "EngineComparison.h"
+
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+
+#include "Benchmark.h"
+#include "BatchRunner.h"
+#include "PhaseRecorder.h"
+
+
+struct EngineRun
+{
+    //What one engine made of one input
+    bool Solved {false};
+    double Seconds {0};                 //Parse and both parts, fastest of the repetitions
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+};
+
+
+EngineRun RunEngine(DaySolver& Engine, RunOptions& Options, PhaseRecorder& Recorder, int Repetitions)
+{
+    EngineRun Run {};
+    Run.Seconds = std::numeric_limits<double>::max();
+
+    for(int Repetition {0}; Repetition < Repetitions; ++Repetition)
+    {
+        Recorder.Reset();
+        if(!RunTimedPhases(Engine, Options, Recorder, Run.AnswerOne, Run.AnswerTwo)){return Run;}
+
+        //The first record is the load, which is the same for both engines
+        double Seconds {0};
+        for(int i_Phase {1}; i_Phase < (int)Recorder.Records.size(); ++i_Phase){Seconds += Recorder.Records[i_Phase].Seconds;}
+        Run.Seconds = std::min(Run.Seconds, Seconds);
+    }
+
+    Run.Solved = true;
+    return Run;
+}
+
+
+int RunEngineComparison(DaySolver& Solver, RunOptions& Options)
+{
+    if(!Solver.FastParse)
+    {
+        std::cout << "Day " << Solver.Day << " only has its reference engine, there is nothing to compare it with" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> Inputs {};
+    if(Options.BatchPath.empty()){Inputs.emplace_back(Options.InputPath);}
+    else{Inputs = GetBatchInputs(Options.BatchPath);}
+    if(Inputs.empty()){return 1;}
+
+    DaySolver Reference {SelectEngine(Solver, EngineReference)};
+    DaySolver Fast {SelectEngine(Solver, EngineFast)};
+    int Repetitions {std::max(1, Options.BenchRepetitions)};
+
+    //Both engines always have to do the work, and each keeps its own arena so neither sizes the other's
+    RunArena ReferenceArena {};
+    RunArena FastArena {};
+    RunOptions ReferenceOptions {Options};
+    ReferenceOptions.Cache = CacheBypass;
+    ReferenceOptions.p_Arena = &ReferenceArena;
+    RunOptions FastOptions {ReferenceOptions};
+    FastOptions.p_Arena = &FastArena;
+
+    PhaseRecorder Recorder(Options);
+
+    int Mismatches {0};
+    int Unsolved {0};
+    double ReferenceTotal {0};
+    double FastTotal {0};
+
+    std::cout << "Day " << Solver.Day << " engines, fastest of " << Repetitions << " run(s) each\n";
+    std::cout << std::right << std::setw(16) << "reference (ms)" << std::setw(12) << "fast (ms)" << std::setw(10) << "speedup"
+              << "   " << std::left << std::setw(10) << "answers" << "input\n";
+
+    for(std::string& Input : Inputs)
+    {
+        ReferenceOptions.InputPath = Input;
+        FastOptions.InputPath = Input;
+
+        EngineRun ReferenceRun {RunEngine(Reference, ReferenceOptions, Recorder, Repetitions)};
+        EngineRun FastRun {RunEngine(Fast, FastOptions, Recorder, Repetitions)};
+
+        if(!ReferenceRun.Solved || !FastRun.Solved)
+        {
+            ++Unsolved;
+            std::cout << std::right << std::setw(16) << "-" << std::setw(12) << "-" << std::setw(10) << "-" << "   "
+                      << std::left << std::setw(10) << (ReferenceRun.Solved ? "fast" : FastRun.Solved ? "reference" : "both")
+                      << Input << " (not solved)\n";
+            continue;
+        }
+
+        bool Match {ReferenceRun.AnswerOne == FastRun.AnswerOne && ReferenceRun.AnswerTwo == FastRun.AnswerTwo};
+        if(!Match){++Mismatches;}
+        ReferenceTotal += ReferenceRun.Seconds;
+        FastTotal += FastRun.Seconds;
+
+        std::cout << std::right << std::fixed << std::setprecision(4)
+                  << std::setw(16) << ReferenceRun.Seconds * 1000.0 << std::setw(12) << FastRun.Seconds * 1000.0
+                  << std::setprecision(2) << std::setw(9) << ReferenceRun.Seconds / std::max(FastRun.Seconds, 1e-9) << "x"
+                  << std::defaultfloat << "   " << std::left << std::setw(10) << (Match ? "match" : "MISMATCH") << Input << "\n";
+
+        if(!Match)
+        {
+            std::cout << "    reference: " << ReferenceRun.AnswerOne << " / " << ReferenceRun.AnswerTwo << "\n"
+                      << "    fast:      " << FastRun.AnswerOne << " / " << FastRun.AnswerTwo << "\n";
+        }
+    }
+
+    std::cout << "\nEngines: " << Inputs.size() << " input(s), " << Mismatches << " mismatch(es), " << Unsolved << " not solved; "
+              << std::fixed << std::setprecision(3) << "reference " << ReferenceTotal * 1000.0 << " ms, fast " << FastTotal * 1000.0
+              << " ms in total, " << std::setprecision(2) << ReferenceTotal / std::max(FastTotal, 1e-9) << "x speedup"
+              << std::defaultfloat << std::endl;
+
+    return Mismatches || Unsolved ? 1 : 0;
+}
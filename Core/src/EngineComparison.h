@@ -0,0 +1,24 @@
+/*
+Differential check of a day's fast engine against its reference engine (--engine=both)
+
+    Every optimised path is registered next to the straightforward implementation it replaces (SolverRegistry.h)
+    This runs both on the same inputs, so an optimisation never ships without an equivalence check:
+
+        ./aoc --day=5 --engine=both input.txt
+        ./aoc --day=5 --engine=both --batch=generated/ --bench=5
+
+    Every input is parsed and solved by both engines, never from the result cache, --bench=N takes the fastest of N
+    runs of each instead of a single one. Load is left out of the timings, both engines read the same bytes
+    One line per input with both times, the speedup and whether the answers agree, the answers of both engines are
+    printed for any input where they do not, then a summary over all inputs
+
+    Returns non zero if any input could not be solved or the engines disagreed on any answer
+*/
+
+#pragma once
+
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+
+
+int RunEngineComparison(DaySolver& Solver, RunOptions& Options);
@@ -0,0 +1,111 @@
+#include "InputLoader.h"
+
+#include <iostream>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+InputLines::~InputLines()
+{
+    //Release the mapping, the views in Lines are invalid from here on out
+    if(p_Data)
+    {
+        munmap((void*)p_Data, DataSize);
+        p_Data = nullptr;
+    }
+}
+
+
+void IndexLines(InputLines* p_InputLines, char Delimiter)
+{
+    //Walk the mapped bytes once and note down where each segment starts and how long it is
+    //memchr does the heavy lifting here, it is vectorised by libc and a lot quicker than a char by char loop
+
+    const char* p_Cursor {p_InputLines->p_Data};
+    const char* p_End    {p_InputLines->p_Data + p_InputLines->DataSize};
+
+    //Rough guess to avoid most of the regrowing of the vector, assuming lines of about 16 characters
+    p_InputLines->Lines.reserve(p_InputLines->DataSize / 16 + 1);
+
+    while(p_Cursor < p_End)
+    {
+        const char* p_Found {(const char*)std::memchr(p_Cursor, Delimiter, p_End - p_Cursor)};
+        const char* p_SegmentEnd {p_Found ? p_Found : p_End};
+
+        std::string_view Segment(p_Cursor, p_SegmentEnd - p_Cursor);
+
+        if(Delimiter != '\n')
+        {
+            //getline with a custom delimiter would keep the line breaks, these are never wanted
+            while(Segment.size() && (Segment.back() == '\n' || Segment.back() == '\r')){Segment.remove_suffix(1);}
+            while(Segment.size() && (Segment.front() == '\n' || Segment.front() == '\r')){Segment.remove_prefix(1);}
+
+            //A trailing line break after the last segment should not count as an extra segment
+            if(!p_Found && !Segment.size()){break;}
+        }
+        else if(Segment.size() && Segment.back() == '\r')
+        {
+            //Windows line endings
+            Segment.remove_suffix(1);
+        }
+
+        p_InputLines->Lines.emplace_back(Segment);
+
+        //Step over the delimiter itself
+        p_Cursor = p_SegmentEnd + 1;
+    }
+}
+
+
+InputLines* MapFile(std::string DataPath)
+{
+    //Memory map the input file, without looking at its contents yet
+
+    InputLines* p_InputLines = new InputLines;
+
+    int FileDescriptor {open(DataPath.c_str(), O_RDONLY)};
+    if(FileDescriptor < 0)
+    {
+        //Error handling if file cannot be opened
+        std::cout << "Cannot open file" << std::endl;
+        return p_InputLines;
+    }
+
+    struct stat FileStats;
+    if(fstat(FileDescriptor, &FileStats) == 0 && FileStats.st_size > 0)
+    {
+        void* p_Mapping {mmap(nullptr, FileStats.st_size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0)};
+
+        if(p_Mapping != MAP_FAILED)
+        {
+            //The file is read front to back exactly once, let the kernel know to read ahead aggressively
+            madvise(p_Mapping, FileStats.st_size, MADV_SEQUENTIAL);
+
+            p_InputLines->p_Data   = (const char*)p_Mapping;
+            p_InputLines->DataSize = FileStats.st_size;
+        }
+        else
+        {
+            std::cout << "Cannot map file" << std::endl;
+        }
+    }
+
+    //The mapping stays valid after closing the descriptor
+    close(FileDescriptor);
+
+    return p_InputLines;
+}
+
+
+InputLines* GetFileData(std::string DataPath, char Delimiter)
+{
+    //Memory map the input file and create an index of lines that can be used during runtime
+
+    InputLines* p_InputLines {MapFile(DataPath)};
+    if(p_InputLines->p_Data){IndexLines(p_InputLines, Delimiter);}
+
+    return p_InputLines;
+}
@@ -0,0 +1,55 @@
+/*
+Shared input loader for all Advent of Code 2025 C++ projects
+
+    Instead of streaming the input file through std::ifstream and copying every line into its own std::string,
+    the whole file is memory mapped and only an index of the lines is built
+
+        File on disk:    L68\nL30\nR48\n
+        Line index:      {0, 3} {4, 3} {8, 3}      <- stored as std::string_views pointing straight into the mapping
+
+    No line is ever copied, the mapping stays alive for as long as the InputLines object does
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+
+struct InputLines
+{
+    //Owns the memory mapped file and the views into it
+    //Copying is disabled, the views would dangle as soon as one of the copies unmaps the file
+
+    InputLines() = default;
+    InputLines(const InputLines&) = delete;
+    InputLines& operator=(const InputLines&) = delete;
+    ~InputLines();
+
+    const char* p_Data {nullptr};               //Start of the mapping, nullptr if nothing was mapped
+    std::size_t DataSize {0};                    //Size of the mapping in bytes
+    std::vector<std::string_view> Lines {};      //One view per line (or per delimited segment)
+
+    //Just enough of the std::vector interface to let the solvers treat this like the old vector of strings
+    std::size_t size() const {return Lines.size();}
+    bool empty() const {return Lines.empty();}
+    std::string_view operator[](std::size_t Index) const {return Lines[Index];}
+    std::string_view front() const {return Lines.front();}
+    std::string_view back() const {return Lines.back();}
+    std::vector<std::string_view>::const_iterator begin() const {return Lines.begin();}
+    std::vector<std::string_view>::const_iterator end() const {return Lines.end();}
+};
+
+
+//Map the file at DataPath and split it on Delimiter
+//With the default '\n' this behaves like getline, with another delimiter (i.e. ',' for Day 02) line breaks are
+//additionally stripped from the ends of each segment
+InputLines* GetFileData(std::string DataPath, char Delimiter = '\n');
+
+//Only map the file at DataPath, Lines stays empty, for callers that look at the bytes before deciding how to index them
+InputLines* MapFile(std::string DataPath);
+
+//Build the line index over an already available block of memory, used by GetFileData and the benchmarks
+void IndexLines(InputLines* p_InputLines, char Delimiter);
@@ -0,0 +1,104 @@
+#include "LineStream.h"
+
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+LineStream::LineStream(std::string DataPath, std::size_t ChunkSize) : Buffer(ChunkSize)
+{
+    if(DataPath == "-")
+    {
+        FileDescriptor = STDIN_FILENO;
+        return;
+    }
+
+    FileDescriptor = open(DataPath.c_str(), O_RDONLY);
+    OwnsDescriptor = true;
+
+    if(FileDescriptor < 0)
+    {
+        //Error handling if file cannot be opened
+        std::cout << "Cannot open file" << std::endl;
+    }
+}
+
+
+LineStream::~LineStream()
+{
+    if(OwnsDescriptor && FileDescriptor >= 0){close(FileDescriptor);}
+}
+
+
+bool LineStream::FillBuffer()
+{
+    //Move the unread tail to the front, then top the buffer up with the next chunk
+
+    if(Begin > 0)
+    {
+        std::memmove(Buffer.data(), Buffer.data() + Begin, End - Begin);
+        End -= Begin;
+        Begin = 0;
+    }
+
+    //A line longer than the whole buffer, no choice but to grow
+    if(End == Buffer.size()){Buffer.resize(Buffer.size() * 2);}
+
+    while(true)
+    {
+        ssize_t Read {read(FileDescriptor, Buffer.data() + End, Buffer.size() - End)};
+
+        if(Read > 0)
+        {
+            End += Read;
+            BytesRead += Read;
+            return true;
+        }
+        if(Read < 0 && errno == EINTR){continue;}
+
+        EndOfInput = true;
+        return false;
+    }
+}
+
+
+bool LineStream::NextLine(std::string_view& Line)
+{
+    if(FileDescriptor < 0){return false;}
+
+    std::size_t SearchFrom {Begin};
+
+    while(true)
+    {
+        const char* p_Found {(const char*)std::memchr(Buffer.data() + SearchFrom, '\n', End - SearchFrom)};
+
+        if(p_Found)
+        {
+            std::size_t LineEnd = p_Found - Buffer.data();
+            Line = std::string_view(Buffer.data() + Begin, LineEnd - Begin);
+            Begin = LineEnd + 1;
+            break;
+        }
+
+        if(EndOfInput)
+        {
+            //Last line without a trailing line break
+            if(Begin == End){return false;}
+            Line = std::string_view(Buffer.data() + Begin, End - Begin);
+            Begin = End;
+            break;
+        }
+
+        //No complete line in the buffer yet, read more and carry on searching where we left off
+        std::size_t Searched {End - Begin};
+        FillBuffer();
+        SearchFrom = Begin + Searched;
+    }
+
+    //Windows line endings
+    if(Line.size() && Line.back() == '\r'){Line.remove_suffix(1);}
+
+    return true;
+}
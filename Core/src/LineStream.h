@@ -0,0 +1,45 @@
+/*
+Chunked line reader for streaming runs
+
+    Reads a file descriptor (stdin, a FIFO, or a regular file) in fixed size chunks and hands out one line at a time
+    Memory use is the size of the chunk buffer, no matter how large the input is, the buffer only grows if
+    a single line does not fit in it
+
+    The string_view handed out by NextLine is only valid until the next call
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+
+struct LineStream
+{
+    //"-" reads from stdin
+    explicit LineStream(std::string DataPath, std::size_t ChunkSize = 1 << 20);
+    ~LineStream();
+
+    LineStream(const LineStream&) = delete;
+    LineStream& operator=(const LineStream&) = delete;
+
+    bool IsOpen() const {return FileDescriptor >= 0;}
+
+    //Fetch the next line without its line break, false once the input is exhausted
+    bool NextLine(std::string_view& Line);
+
+    //Bytes consumed so far, handy for progress and throughput numbers
+    std::size_t BytesRead {0};
+
+private:
+    bool FillBuffer();
+
+    int FileDescriptor {-1};
+    bool OwnsDescriptor {false};
+    bool EndOfInput {false};
+    std::vector<char> Buffer {};
+    std::size_t Begin {0};      //First unread byte in Buffer
+    std::size_t End {0};        //One past the last valid byte in Buffer
+};
@@ -0,0 +1,90 @@
+/*
+Shared main for all Advent of Code 2025 C++ projects
+
+    Per-day builds link exactly one day, that day runs without needing --day
+    The combined ./aoc build links every day and needs --day=N to pick one, or --all to run them all at once
+*/
+
+#include <iostream>
+
+#include "CommandLine.h"
+#include "SolverRegistry.h"
+#include "Benchmark.h"
+#include "AllDaysRunner.h"
+#include "BatchRunner.h"
+#include "EngineComparison.h"
+#include "CompiledInput.h"
+#include "Checkpoint.h"
+#include "Trace.h"
+#include "MemoryUsage.h"
+
+
+int RunSelectedMode(RunOptions& Options)
+{
+    if(Options.AllDays){return RunAllDays(Options);}
+
+    std::vector<DaySolver>& Solvers {GetSolvers()};
+
+    //Default to the only linked in day
+    if(Options.Day < 0 && Solvers.size() == 1){Options.Day = Solvers.front().Day;}
+
+    DaySolver* p_Solver {FindSolver(Options.Day)};
+    if(!p_Solver)
+    {
+        std::cout << "No solver registered for day " << Options.Day << ", available days:";
+        for(DaySolver& Solver : Solvers){std::cout << " " << Solver.Day;}
+        std::cout << std::endl;
+        return 1;
+    }
+
+    if(Options.Engine == EngineBoth){return RunEngineComparison(*p_Solver, Options);}
+
+    DaySolver Solver {SelectEngine(*p_Solver, Options.Engine)};
+
+    if(!Options.BatchPath.empty()){return RunBatch(Solver, Options);}
+
+    //Compiled inputs are always written from the reference engine's data
+    if(Options.CompileInput){return CompileSolverInput(*p_Solver, Options);}
+
+    if(Options.Checkpoint){return RunCheckpointedSolver(Solver, Options);}
+
+    if(!Options.Queries.empty()){return RunQuerySolver(Solver, Options);}
+
+    if(Options.Streaming){return RunStreamingSolver(Solver, Options);}
+
+    if(Options.BenchRepetitions > 0){return RunBenchmark(Solver, Options);}
+
+    return RunSolver(Solver, Options);
+}
+
+
+int main(int argc, char* argv[])
+{
+    RunOptions Options {};
+    if(!ParseCommandLine(argc, argv, Options)){return 1;}
+
+    if(!Options.TracePath.empty())
+    {
+        EnableTracing();
+        SetTraceThreadName("main");
+    }
+
+    if(Options.MemoryBudget > 0){SetMemoryBudget(Options.MemoryBudget);}
+
+    //The runners catch going over the budget around the phases themselves, this catches it anywhere else
+    //(streaming, compiling an input) so the process still ends with a report rather than an abort
+    int Result {1};
+    try
+    {
+        Result = RunSelectedMode(Options);
+    }
+    catch(MemoryBudgetExceeded& Exceeded)
+    {
+        std::cout << "Day " << Options.Day << ": " << DescribeBudgetExceeded(Exceeded) << std::endl;
+    }
+
+    //Every runner has joined its threads by now, so all spans are in
+    if(!Options.TracePath.empty() && !WriteTrace(Options.TracePath)){return 1;}
+
+    return Result;
+}
@@ -0,0 +1,110 @@
+#include "MemoryUsage.h"
+
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+
+namespace
+{
+    //Value of a "VmRSS:    8756 kB" line in bytes, -1 if the field is not there
+    std::int64_t FindStatusField(const char* p_Status, const char* Field)
+    {
+        const char* p_Field {std::strstr(p_Status, Field)};
+        if(!p_Field){return -1;}
+
+        return std::strtoll(p_Field + std::strlen(Field), nullptr, 10) * 1024;
+    }
+}
+
+
+void MemoryUsage::Accumulate(const MemoryUsage& Other)
+{
+    ResidentBytes += Other.ResidentBytes;
+    PeakResidentBytes = std::max(PeakResidentBytes, Other.PeakResidentBytes);
+}
+
+
+MemoryUsage GetMemoryUsage()
+{
+    MemoryUsage Usage {};
+
+    //Plain read into a stack buffer, sampling memory should not itself show up in the allocation counters
+    char Status[4096] {};
+    int File {open("/proc/self/status", O_RDONLY | O_CLOEXEC)};
+    if(File >= 0)
+    {
+        ssize_t Length {read(File, Status, sizeof(Status) - 1)};
+        close(File);
+        Status[std::max<ssize_t>(0, Length)] = '\0';
+
+        Usage.ResidentBytes = std::max<std::int64_t>(0, FindStatusField(Status, "VmRSS:"));
+        Usage.PeakResidentBytes = FindStatusField(Status, "VmHWM:");
+    }
+
+    if(Usage.PeakResidentBytes < 0 || File < 0)
+    {
+        //ru_maxrss is in KiB on Linux, and cannot be reset
+        rusage Resources {};
+        getrusage(RUSAGE_SELF, &Resources);
+        Usage.PeakResidentBytes = (std::int64_t)Resources.ru_maxrss * 1024;
+    }
+
+    return Usage;
+}
+
+
+bool ResetPeakResident()
+{
+    //5 resets the peak resident set size to the current one (Linux 4.0 and up)
+    int File {open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC)};
+    if(File < 0){return false;}
+
+    bool Reset {write(File, "5", 1) == 1};
+    close(File);
+
+    return Reset;
+}
+
+
+MemoryUsage GetMemoryDelta(const MemoryUsage& Before, const MemoryUsage& After)
+{
+    MemoryUsage Delta {};
+    Delta.ResidentBytes = After.ResidentBytes - Before.ResidentBytes;
+    Delta.PeakResidentBytes = After.PeakResidentBytes;
+
+    return Delta;
+}
+
+
+std::string DescribeBytes(double Bytes)
+{
+    const char* Units[] {"B", "KiB", "MiB", "GiB"};
+    int Unit {0};
+    while((Bytes >= 1024.0 || Bytes <= -1024.0) && Unit < 3){Bytes /= 1024.0; ++Unit;}
+
+    std::ostringstream Description;
+    Description << std::fixed << std::setprecision(Unit ? 1 : 0) << Bytes << " " << Units[Unit];
+
+    return Description.str();
+}
+
+
+std::string DescribeMemory(const MemoryUsage& Usage)
+{
+    return "rss " + std::string(Usage.ResidentBytes < 0 ? "" : "+") + DescribeBytes((double)Usage.ResidentBytes)
+         + "  peak rss " + DescribeBytes((double)Usage.PeakResidentBytes);
+}
+
+
+std::string DescribeBudgetExceeded(const MemoryBudgetExceeded& Exceeded)
+{
+    return "memory budget of " + DescribeBytes((double)GetMemoryBudget()) + " exceeded: "
+         + DescribeBytes((double)Exceeded.RequestedBytes) + " requested with " + DescribeBytes((double)Exceeded.LiveBytes)
+         + " of heap live, peak rss " + DescribeBytes((double)GetMemoryUsage().PeakResidentBytes);
+}
@@ -0,0 +1,48 @@
+/*
+Resident memory of the process (--memory) and what to say when the heap budget runs out (--memory-budget=MB)
+
+    --allocations counts what the day asks of the heap, this is what the kernel actually had to hand out for it:
+
+        ResidentBytes       VmRSS, pages of the process currently in memory, mapped inputs included
+        PeakResidentBytes   VmHWM, the high water mark of VmRSS
+
+    Both come from /proc/self/status, or from getrusage (peak only) where there is no /proc
+    The high water mark can be reset through /proc/self/clear_refs, so every phase gets a peak of its own
+
+    These are numbers for the whole process: in the all-days and batch runners, days running side by side share them
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "AllocationTracker.h"
+
+
+struct MemoryUsage
+{
+    std::int64_t ResidentBytes {0};
+    std::int64_t PeakResidentBytes {0};
+
+    //Add another sample on top of this one, resident bytes add up, the peak is the highest of the two
+    void Accumulate(const MemoryUsage& Other);
+};
+
+
+MemoryUsage GetMemoryUsage();
+
+//Start a fresh high water mark at whatever is resident right now, false if the kernel does not allow it
+bool ResetPeakResident();
+
+//Growth of the resident set between two samples, and the peak as of the second one
+MemoryUsage GetMemoryDelta(const MemoryUsage& Before, const MemoryUsage& After);
+
+//"12.3 MiB", "512 B"
+std::string DescribeBytes(double Bytes);
+
+//Short "rss +1.2 MiB  peak rss 45.6 MiB" summary
+std::string DescribeMemory(const MemoryUsage& Usage);
+
+//"memory budget of 64.0 MiB exceeded: 1.5 MiB requested with 63.9 MiB of heap live, peak rss 80.1 MiB"
+std::string DescribeBudgetExceeded(const MemoryBudgetExceeded& Exceeded);
@@ -0,0 +1,236 @@
+/*
+Allocation free number parsing for puzzle input
+
+    Every day used to isolate its numbers with std::stoi/std::stoul on a temporary std::string, or by pushing the
+    line through a std::stringstream and getline. Both allocate and both go through the locale machinery, for input
+    that is never anything but plain ASCII digits
+
+    These helpers work straight on the string_views handed out by InputLoader/LineStream:
+
+        ParseUnsigned(Text, Value)          "1234"       whole field must be digits
+        ParseSigned(Text, Value)            "-12", "+7"  optional sign, then digits
+        ParseRange(Text, First, Last)       "11-22"      two unsigned numbers around a separator
+        ParsePair(Text, X, Y)               "7,1"        same, defaults to ',' as the separator
+        ParseList(Text, Vector)             "3,5,4,7"    appends every number to the vector
+        ToUnsigned<T>(Text)                 convenience for when the input is trusted, returns 0 on garbage
+
+    Spaces at either end of the text are skipped, anything else that is not a digit or the expected separator makes the
+    parse fail (return false)
+
+    Digits are consumed 8 at a time where possible (SWAR, SIMD Within A Register): 8 characters are loaded into one
+    64 bit word, the digits among them are found with a couple of mask operations, then combined into a number with
+    3 multiplies instead of up to 8 dependent multiply-adds. Only when fewer than 8 characters are left in the view
+    does it fall back to the plain one digit at a time loop, nothing is ever read past the end of the view
+
+    No overflow checking is done, the caller picks an integer type wide enough for its input, unsigned __int128 included
+    The word loads assume a little endian machine, which is everything this is ever going to run on
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include <type_traits>
+
+
+namespace NumberParsing
+{
+
+inline std::uint64_t LoadEightCharacters(const char* p_Characters)
+{
+    //memcpy keeps this legal for unaligned addresses, compilers turn it into a single load
+    std::uint64_t Chunk {0};
+    std::memcpy(&Chunk, p_Characters, 8);
+    return Chunk;
+}
+
+
+inline std::uint64_t GetNonDigitMask(std::uint64_t DigitValues)
+{
+    //DigitValues is the loaded word with '0' already taken off every byte (xor, so no borrows between bytes)
+    //A byte is a digit if its high nibble is now 0 and its low nibble is below 10, adding 6 then does not reach 16
+    //Returns a word with 0x10 or higher bits set in every byte that is NOT a digit
+    return (DigitValues & 0xF0F0F0F0F0F0F0F0) | (((DigitValues & 0x0F0F0F0F0F0F0F0F) + 0x0606060606060606) & 0x1010101010101010);
+}
+
+
+inline std::uint32_t CombineEightDigits(std::uint64_t DigitValues)
+{
+    //One digit value (0-9) per byte, first character in the lowest byte, so it is the most significant digit
+
+    //Pairs of digits into 2 digit numbers in every other byte
+    DigitValues = (DigitValues * 10) + (DigitValues >> 8);
+
+    //Pairs of 2 digit numbers into 4 digit numbers, then both halves into the final 8 digit number
+    DigitValues = (((DigitValues & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+                   (((DigitValues >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+
+    return (std::uint32_t)DigitValues;
+}
+
+
+inline std::string_view TrimSpaces(std::string_view Text)
+{
+    while(!Text.empty() && Text.front() == ' '){Text.remove_prefix(1);}
+    while(!Text.empty() && Text.back() == ' '){Text.remove_suffix(1);}
+    return Text;
+}
+
+
+template<typename Integer>
+std::size_t ParseDigits(std::string_view Text, Integer& Value)
+{
+    //Consume the leading run of digits, returns how many characters were used (0 means there was no number)
+    //unsigned __int128 only counts as integral in the GNU dialects, it is accepted here all the same
+    static_assert(std::is_integral_v<Integer> || std::is_same_v<Integer, unsigned __int128>, "ParseDigits needs an integer type");
+
+    const char* p_Cursor {Text.data()};
+    const char* p_End {Text.data() + Text.size()};
+    Integer Result {0};
+
+    static constexpr std::uint32_t PowersOfTen[9] {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+    //Whenever 8 characters can be read without leaving the view, take them in one go
+    //A run of fewer than 8 digits is shifted up so the missing high digits read as leading zeros
+    while(p_End - p_Cursor >= 8)
+    {
+        std::uint64_t DigitValues {LoadEightCharacters(p_Cursor) ^ 0x3030303030303030};
+        std::uint64_t NonDigits {GetNonDigitMask(DigitValues)};
+
+        if(!NonDigits)
+        {
+            Result = (Integer)(Result * (Integer)100000000 + (Integer)CombineEightDigits(DigitValues));
+            p_Cursor += 8;
+            continue;
+        }
+
+        int Digits {__builtin_ctzll(NonDigits) >> 3};
+        if(Digits)
+        {
+            Result = (Integer)(Result * (Integer)PowersOfTen[Digits] + (Integer)CombineEightDigits(DigitValues << (64 - 8 * Digits)));
+            p_Cursor += Digits;
+        }
+
+        Value = Result;
+        return p_Cursor - Text.data();
+    }
+
+    while(p_Cursor < p_End && (unsigned char)(*p_Cursor - '0') < 10)
+    {
+        Result = (Integer)(Result * 10 + (*p_Cursor - '0'));
+        ++p_Cursor;
+    }
+
+    Value = Result;
+    return p_Cursor - Text.data();
+}
+
+
+template<typename Integer>
+bool ParseUnsigned(std::string_view Text, Integer& Value)
+{
+    Text = TrimSpaces(Text);
+    std::size_t Used {ParseDigits(Text, Value)};
+    return Used && Used == Text.size();
+}
+
+
+template<typename Integer>
+bool ParseRange(std::string_view Text, Integer& First, Integer& Last, char Separator = '-')
+{
+    //Walk straight through, the separator has to sit right after the first run of digits
+    Text = TrimSpaces(Text);
+    std::size_t Used {ParseDigits(Text, First)};
+    if(!Used || Used >= Text.size() || Text[Used] != Separator){return false;}
+
+    Text.remove_prefix(Used + 1);
+    Used = ParseDigits(Text, Last);
+    return Used && Used == Text.size();
+}
+
+
+template<typename Integer>
+bool ParseSignedField(std::string_view& Text, Integer& Value)
+{
+    //One optionally signed number off the front of Text, which is moved past it
+    bool Negative {!Text.empty() && Text.front() == '-'};
+    if(!Text.empty() && (Text.front() == '-' || Text.front() == '+')){Text.remove_prefix(1);}
+
+    //Accumulate as unsigned so the most negative value does not overflow on the way
+    std::make_unsigned_t<Integer> Magnitude {0};
+    std::size_t Used {ParseDigits(Text, Magnitude)};
+    if(!Used){return false;}
+
+    Value = Negative ? (Integer)(0 - Magnitude) : (Integer)Magnitude;
+    Text.remove_prefix(Used);
+    return true;
+}
+
+
+template<typename Integer>
+bool ParseField(std::string_view& Text, Integer& Value)
+{
+    if constexpr(std::is_signed_v<Integer>)
+    {
+        return ParseSignedField(Text, Value);
+    }
+    else
+    {
+        std::size_t Used {ParseDigits(Text, Value)};
+        Text.remove_prefix(Used);
+        return Used;
+    }
+}
+
+
+template<typename Integer>
+bool ParseSigned(std::string_view Text, Integer& Value)
+{
+    static_assert(std::is_signed_v<Integer>, "ParseSigned needs a signed integer type");
+
+    Text = TrimSpaces(Text);
+    return ParseSignedField(Text, Value) && Text.empty();
+}
+
+
+template<typename Integer>
+bool ParsePair(std::string_view Text, Integer& X, Integer& Y, char Separator = ',')
+{
+    //Same as a range, but coordinates may be negative
+    Text = TrimSpaces(Text);
+    if(!ParseField(Text, X) || Text.empty() || Text.front() != Separator){return false;}
+
+    Text.remove_prefix(1);
+    return ParseField(Text, Y) && Text.empty();
+}
+
+
+template<typename Integer>
+bool ParseList(std::string_view Text, std::vector<Integer>& Values, char Separator = ',')
+{
+    //Appends, so several lists can be collected into one vector; stops at the first bad field
+    Text = TrimSpaces(Text);
+    while(true)
+    {
+        Integer Value {0};
+        if(!ParseField(Text, Value)){return false;}
+        Values.emplace_back(Value);
+
+        if(Text.empty()){return true;}
+        if(Text.front() != Separator){return false;}
+        Text.remove_prefix(1);
+    }
+}
+
+
+template<typename Integer>
+Integer ToUnsigned(std::string_view Text)
+{
+    Integer Value {0};
+    if(!ParseUnsigned(Text, Value)){return 0;}
+    return Value;
+}
+
+} //namespace NumberParsing
@@ -0,0 +1,146 @@
+#include "PerfCounters.h"
+
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+void CounterSample::Accumulate(const CounterSample& Other)
+{
+    for(int Kind {0}; Kind < CounterKinds; ++Kind)
+    {
+        Values[Kind] += Other.Values[Kind];
+        Valid[Kind] = Valid[Kind] || Other.Valid[Kind];
+    }
+}
+
+
+int OpenCounter(std::uint32_t Type, std::uint64_t Config)
+{
+    //There is no glibc wrapper for perf_event_open
+
+    struct perf_event_attr Attributes;
+    std::memset(&Attributes, 0, sizeof(Attributes));
+    Attributes.size = sizeof(Attributes);
+    Attributes.type = Type;
+    Attributes.config = Config;
+    Attributes.disabled = 1;
+    Attributes.exclude_kernel = 1;
+    Attributes.exclude_hv = 1;
+    Attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &Attributes, 0, -1, -1, 0);
+}
+
+
+PerfCounters::PerfCounters()
+{
+    const std::uint64_t L1DReadMiss {PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+
+    FileDescriptors[CounterCycles]       = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    FileDescriptors[CounterInstructions] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    FileDescriptors[CounterL1DMisses]    = OpenCounter(PERF_TYPE_HW_CACHE, L1DReadMiss);
+    FileDescriptors[CounterLLCMisses]    = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    FileDescriptors[CounterBranches]     = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS);
+    FileDescriptors[CounterBranchMisses] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+
+    //Remember why the first one failed, so "unavailable" comes with a hint
+    if(!IsAvailable())
+    {
+        UnavailableReason = std::strerror(errno);
+        if(errno == EACCES || errno == EPERM){UnavailableReason += ", check /proc/sys/kernel/perf_event_paranoid";}
+        if(errno == ENOENT || errno == ENODEV){UnavailableReason += ", no hardware PMU exposed (VM or container)";}
+    }
+}
+
+
+PerfCounters::~PerfCounters()
+{
+    for(int& FileDescriptor : FileDescriptors)
+    {
+        if(FileDescriptor >= 0){close(FileDescriptor);}
+        FileDescriptor = -1;
+    }
+}
+
+
+bool PerfCounters::IsAvailable() const
+{
+    for(int FileDescriptor : FileDescriptors)
+    {
+        if(FileDescriptor >= 0){return true;}
+    }
+
+    return false;
+}
+
+
+void PerfCounters::Start()
+{
+    for(int FileDescriptor : FileDescriptors)
+    {
+        if(FileDescriptor < 0){continue;}
+        ioctl(FileDescriptor, PERF_EVENT_IOC_RESET, 0);
+        ioctl(FileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+
+CounterSample PerfCounters::Stop()
+{
+    CounterSample Sample {};
+
+    //Stop everything first, so reading the first counters does not get counted by the last ones
+    for(int FileDescriptor : FileDescriptors)
+    {
+        if(FileDescriptor >= 0){ioctl(FileDescriptor, PERF_EVENT_IOC_DISABLE, 0);}
+    }
+
+    for(int Kind {0}; Kind < CounterKinds; ++Kind)
+    {
+        if(FileDescriptors[Kind] < 0){continue;}
+
+        //{value, time enabled, time running}
+        std::uint64_t Reading[3] {};
+        if(read(FileDescriptors[Kind], Reading, sizeof(Reading)) != sizeof(Reading) || Reading[2] == 0){continue;}
+
+        Sample.Values[Kind] = (double)Reading[0] * ((double)Reading[1] / (double)Reading[2]);
+        Sample.Valid[Kind] = true;
+    }
+
+    return Sample;
+}
+
+
+std::string DescribeCounters(const CounterSample& Sample)
+{
+    std::ostringstream Description;
+    Description << std::fixed << std::setprecision(2);
+
+    const double* Values {Sample.Values};
+    const bool* Valid {Sample.Valid};
+    double KiloInstructions {Values[CounterInstructions] / 1000.0};
+
+    Description << "IPC ";
+    if(Valid[CounterCycles] && Valid[CounterInstructions] && Values[CounterCycles] > 0){Description << Values[CounterInstructions] / Values[CounterCycles];}
+    else{Description << "-";}
+
+    Description << "  L1D ";
+    if(Valid[CounterL1DMisses] && Valid[CounterInstructions] && KiloInstructions > 0){Description << Values[CounterL1DMisses] / KiloInstructions << "/ki";}
+    else{Description << "-";}
+
+    Description << "  LLC ";
+    if(Valid[CounterLLCMisses] && Valid[CounterInstructions] && KiloInstructions > 0){Description << Values[CounterLLCMisses] / KiloInstructions << "/ki";}
+    else{Description << "-";}
+
+    Description << "  br-miss ";
+    if(Valid[CounterBranches] && Valid[CounterBranchMisses] && Values[CounterBranches] > 0){Description << 100.0 * Values[CounterBranchMisses] / Values[CounterBranches] << "%";}
+    else{Description << "-";}
+
+    return Description.str();
+}
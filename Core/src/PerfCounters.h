@@ -0,0 +1,66 @@
+/*
+Hardware performance counters around solver phases (--counters)
+
+    Uses perf_event_open to count, for the calling thread only and in user space only:
+
+        cycles, instructions, L1 data cache read misses, last level cache misses, branches and branch misses
+
+    From those each phase gets an IPC, misses per thousand instructions and a branch miss rate, which says a lot more
+    about WHY a phase got slower than wall time alone
+
+    Each counter is opened on its own, so a machine (or container) that lacks some of them still reports the rest
+    If none can be opened (perf_event_paranoid, seccomp, no PMU in the VM) everything keeps working without counters
+*/
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+
+enum CounterKind
+{
+    CounterCycles,
+    CounterInstructions,
+    CounterL1DMisses,
+    CounterLLCMisses,
+    CounterBranches,
+    CounterBranchMisses,
+    CounterKinds
+};
+
+
+struct CounterSample
+{
+    double Values[CounterKinds] {};
+    bool Valid[CounterKinds] {};
+
+    //Add another sample on top of this one, used to total up repetitions
+    void Accumulate(const CounterSample& Other);
+};
+
+
+struct PerfCounters
+{
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    //True if at least one counter could be opened
+    bool IsAvailable() const;
+
+    //Reset and start all open counters
+    void Start();
+
+    //Stop the counters and read them, scaled up if the kernel had to multiplex them
+    CounterSample Stop();
+
+    int FileDescriptors[CounterKinds] {-1, -1, -1, -1, -1, -1};
+    std::string UnavailableReason {};
+};
+
+
+//Short "IPC 1.23  L1 4.5/ki  LLC 0.1/ki  br 1.2%" summary, "-" for anything that was not counted
+std::string DescribeCounters(const CounterSample& Sample);
@@ -0,0 +1,123 @@
+#include "PhaseRecorder.h"
+
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <cstdio>
+
+#include "Trace.h"
+
+
+PhaseRecorder::PhaseRecorder(RunOptions& Options) : TrackMemory {Options.Memory}, Day {Options.Day}
+{
+    if(Options.Allocations)
+    {
+        EnableAllocationTracking();
+        TrackAllocations = true;
+    }
+
+    if(Options.Counters)
+    {
+        p_Counters = new PerfCounters;
+
+        if(!p_Counters->IsAvailable())
+        {
+            //Keep going without them, wall time is still useful on its own
+            //Only say so once, the all-days runner creates a recorder per day
+            static std::once_flag Warned;
+            std::call_once(Warned, [this]()
+            {
+                std::cout << "Hardware counters unavailable (" << p_Counters->UnavailableReason << "), reporting wall time only" << std::endl;
+            });
+            delete p_Counters;
+            p_Counters = nullptr;
+        }
+    }
+}
+
+
+PhaseRecorder::~PhaseRecorder()
+{
+    delete p_Counters;
+    p_Counters = nullptr;
+}
+
+
+void PhaseRecorder::Begin(std::string Name)
+{
+    Records.emplace_back(PhaseRecord {Name, 0, {}, {}, {}});
+    PhaseOpen = true;
+
+    //Counters are started last so their own setup is not part of the phase
+    if(TrackMemory)
+    {
+        ResetPeakResident();
+        PhaseStartMemory = GetMemoryUsage();
+    }
+    if(TrackAllocations)
+    {
+        ResetThreadAllocationPeak();
+        PhaseStartAllocations = GetThreadAllocationCounters();
+    }
+    if(TracingEnabled()){PhaseTraceStart = GetTraceTimestamp();}
+    PhaseClock.Restart();
+    if(p_Counters){p_Counters->Start();}
+}
+
+
+void PhaseRecorder::End()
+{
+    PhaseRecord& Record {Records.back()};
+
+    if(p_Counters){Record.Counters = p_Counters->Stop();}
+    Record.Seconds = PhaseClock.Seconds();
+    if(TrackAllocations){Record.Allocations = GetAllocationDelta(PhaseStartAllocations, GetThreadAllocationCounters());}
+    if(TrackMemory){Record.Memory = GetMemoryDelta(PhaseStartMemory, GetMemoryUsage());}
+    PhaseOpen = false;
+
+    if(TracingEnabled())
+    {
+        //"day 05 parse", so the phases of different days tell apart in the timeline
+        char SpanName[48] {};
+        std::snprintf(SpanName, sizeof(SpanName), "day %02d %s", Day, Record.Name.c_str());
+        RecordTraceSpan(SpanName, "phase", PhaseTraceStart, GetTraceTimestamp());
+    }
+}
+
+
+void PhaseRecorder::Abandon(const MemoryBudgetExceeded& Exceeded)
+{
+    if(PhaseOpen){End();}
+    OverBudget = true;
+
+    std::cout << "Day " << Day << (Records.empty() ? std::string {} : " " + Records.back().Name) << ": "
+              << DescribeBudgetExceeded(Exceeded) << std::endl;
+}
+
+
+void PhaseRecorder::PrintReport()
+{
+    std::cout << "\n" << std::left << std::setw(12) << "Phase" << std::right << std::setw(12) << "wall (ms)";
+    if(TrackAllocations){std::cout << "   heap";}
+    if(TrackMemory){std::cout << "   memory";}
+    if(p_Counters){std::cout << "   counters";}
+    std::cout << "\n";
+
+    for(PhaseRecord& Record : Records)
+    {
+        std::cout << std::left << std::setw(12) << Record.Name << std::right << std::fixed << std::setprecision(4)
+                  << std::setw(12) << Record.Seconds * 1000.0 << std::defaultfloat;
+        if(TrackAllocations){std::cout << "   " << DescribeAllocations(Record.Allocations);}
+        if(TrackMemory){std::cout << "   " << DescribeMemory(Record.Memory);}
+        if(p_Counters){std::cout << "   " << DescribeCounters(Record.Counters);}
+        std::cout << "\n";
+    }
+
+    //Every phase starts its own high water mark, so the run's peak is the highest of them
+    if(TrackMemory)
+    {
+        MemoryUsage Total {};
+        for(PhaseRecord& Record : Records){Total.Accumulate(Record.Memory);}
+        std::cout << "Peak resident memory: " << DescribeBytes((double)Total.PeakResidentBytes) << "\n";
+    }
+}
@@ -0,0 +1,70 @@
+/*
+Per-phase measurements for a single run of a day
+
+    Every runner (normal, benchmark, all-days) walks the same phases: load, parse, part one, part two
+    They bracket each one with Begin/End on a PhaseRecorder, which takes care of wall time and of whatever
+    optional instrumentation was asked for on the command line (--counters, --allocations, --memory, --trace)
+
+    A run that goes over the memory budget is handed to Abandon, which closes the phase it was in and reports it
+
+    The recorder belongs to one thread, the hardware counters and the allocation counters only count the thread that
+    created it
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AllocationTracker.h"
+#include "CommandLine.h"
+#include "MemoryUsage.h"
+#include "PerfCounters.h"
+#include "Timing.h"
+
+
+struct PhaseRecord
+{
+    std::string Name {};
+    double Seconds {0};
+    CounterSample Counters {};
+    AllocationCounters Allocations {};
+    MemoryUsage Memory {};
+};
+
+
+struct PhaseRecorder
+{
+    explicit PhaseRecorder(RunOptions& Options);
+    ~PhaseRecorder();
+
+    PhaseRecorder(const PhaseRecorder&) = delete;
+    PhaseRecorder& operator=(const PhaseRecorder&) = delete;
+
+    void Begin(std::string Name);
+    void End();
+
+    //The run went over the memory budget, close the phase it was in and say where it happened
+    void Abandon(const MemoryBudgetExceeded& Exceeded);
+
+    //Forget the records, but keep the counters open for the next repetition
+    void Reset() {Records.clear(); OverBudget = false;}
+
+    //Print wall time plus whatever instrumentation is enabled, one line per phase
+    void PrintReport();
+
+    std::vector<PhaseRecord> Records {};
+    PerfCounters* p_Counters {nullptr};     //nullptr unless --counters was given
+    bool TrackAllocations {false};
+    bool TrackMemory {false};
+    bool OverBudget {false};               //Set by Abandon, the last record is the phase that ran out
+
+private:
+    Stopwatch PhaseClock {};
+    AllocationCounters PhaseStartAllocations {};
+    MemoryUsage PhaseStartMemory {};
+    bool PhaseOpen {false};
+    int Day {0};
+    std::uint64_t PhaseTraceStart {0};
+};
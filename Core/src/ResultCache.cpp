@@ -0,0 +1,232 @@
+#include "ResultCache.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace
+{
+    const char* EntryMagic {"aoc-result-cache 2"};
+
+    std::atomic<std::uint64_t> Hits {0};
+    std::atomic<std::uint64_t> Misses {0};
+    std::atomic<std::uint64_t> Stores {0};
+    std::atomic<std::uint64_t> Verified {0};
+    std::atomic<std::uint64_t> Mismatches {0};
+
+
+    std::uint64_t Rotate(std::uint64_t Value, int Bits)
+    {
+        return (Value << Bits) | (Value >> (64 - Bits));
+    }
+
+
+    std::uint64_t MixWord(std::uint64_t Lane, std::uint64_t Word)
+    {
+        return Rotate(Lane ^ (Word * 0x9E3779B97F4A7C15), 29) * 0xC2B2AE3D27D4EB4F;
+    }
+
+
+    std::uint64_t Finalise(std::uint64_t Hash)
+    {
+        //splitmix64 finaliser, spreads every input bit over the whole output
+        Hash ^= Hash >> 30;
+        Hash *= 0xBF58476D1CE4E5B9;
+        Hash ^= Hash >> 27;
+        Hash *= 0x94D049BB133111EB;
+        Hash ^= Hash >> 31;
+        return Hash;
+    }
+
+
+    std::string GetEntryPath(RunOptions& Options, const ResultCacheKey& Key)
+    {
+        std::ostringstream Path;
+        Path << Options.CacheDir << "/day" << std::setw(2) << std::setfill('0') << Key.Day << "-v" << Key.Version << "-"
+             << (Key.Engine == EngineFast ? "fast" : "reference") << "-" << std::hex << std::setw(16) << Key.Hash << std::dec << "-" << Key.Size << ".result";
+        return Path.str();
+    }
+
+
+    bool ReadEntry(RunOptions& Options, const ResultCacheKey& Key, std::string& AnswerOne, std::string& AnswerTwo)
+    {
+        //Layout: magic, then day, version, engine, hash and size to guard against a file being copied around under
+        //another name, then each answer as its length in bytes followed by the answer itself
+        std::ifstream Entry(GetEntryPath(Options, Key), std::ios::binary);
+        if(!Entry.is_open()){return false;}
+
+        std::string Magic {};
+        std::getline(Entry, Magic);
+        if(Magic != EntryMagic){return false;}
+
+        ResultCacheKey Stored {};
+        int StoredEngine {-1};
+        Entry >> Stored.Day >> Stored.Version >> StoredEngine >> std::hex >> Stored.Hash >> std::dec >> Stored.Size;
+        if(!Entry || Stored.Day != Key.Day || Stored.Version != Key.Version || StoredEngine != (int)Key.Engine
+           || Stored.Hash != Key.Hash || Stored.Size != Key.Size)
+        {
+            return false;
+        }
+
+        for(std::string* p_Answer : {&AnswerOne, &AnswerTwo})
+        {
+            std::size_t Length {0};
+            Entry >> Length;
+            Entry.get();    //The single separator after the length
+            if(!Entry){return false;}
+
+            p_Answer->resize(Length);
+            Entry.read(p_Answer->data(), Length);
+            if((std::size_t)Entry.gcount() != Length){return false;}
+        }
+
+        return true;
+    }
+}
+
+
+std::uint64_t HashBytes(const char* p_Data, std::size_t Size)
+{
+    std::uint64_t Lanes[4] {0x243F6A8885A308D3, 0x13198A2E03707344, 0xA4093822299F31D0, 0x082EFA98EC4E6C89};
+    std::size_t Offset {0};
+
+    //Four lanes have no dependency on each other, so the multiplies overlap
+    for(; Offset + 32 <= Size; Offset += 32)
+    {
+        for(int Lane {0}; Lane < 4; ++Lane)
+        {
+            std::uint64_t Word {0};
+            std::memcpy(&Word, p_Data + Offset + 8 * Lane, 8);
+            Lanes[Lane] = MixWord(Lanes[Lane], Word);
+        }
+    }
+
+    std::uint64_t Hash {Rotate(Lanes[0], 1) + Rotate(Lanes[1], 7) + Rotate(Lanes[2], 12) + Rotate(Lanes[3], 18)};
+
+    //The last partial block, zero padded, one word at a time
+    for(; Offset < Size; Offset += 8)
+    {
+        std::uint64_t Word {0};
+        std::memcpy(&Word, p_Data + Offset, std::min<std::size_t>(8, Size - Offset));
+        Hash = MixWord(Hash, Word);
+    }
+
+    return Finalise(Hash ^ Size);
+}
+
+
+ResultCacheKey GetResultCacheKey(int Day, int Version, SolverEngine Engine, InputLines* p_InputData)
+{
+    return ResultCacheKey {Day, Version, Engine, HashBytes(p_InputData->p_Data, p_InputData->DataSize), p_InputData->DataSize};
+}
+
+
+bool LoadCachedResult(RunOptions& Options, const ResultCacheKey& Key, std::string& AnswerOne, std::string& AnswerTwo)
+{
+    if(ReadEntry(Options, Key, AnswerOne, AnswerTwo))
+    {
+        ++Hits;
+        return true;
+    }
+
+    ++Misses;
+    return false;
+}
+
+
+void StoreCachedResult(RunOptions& Options, const ResultCacheKey& Key, const std::string& AnswerOne, const std::string& AnswerTwo)
+{
+    //Creating a directory that already exists is fine, anything else shows up when opening the file below
+    mkdir(Options.CacheDir.c_str(), 0755);
+
+    std::string EntryPath {GetEntryPath(Options, Key)};
+
+    //Unique per process and thread, so concurrent writers never share a temporary file
+    std::ostringstream TemporaryPath;
+    TemporaryPath << EntryPath << ".tmp." << getpid() << "." << std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    {
+        std::ofstream Entry(TemporaryPath.str(), std::ios::binary | std::ios::trunc);
+        if(Entry.is_open())
+        {
+            Entry << EntryMagic << "\n" << Key.Day << " " << Key.Version << " " << (int)Key.Engine << " " << std::hex << Key.Hash << std::dec << " " << Key.Size << "\n"
+                  << AnswerOne.size() << "\n" << AnswerOne << "\n" << AnswerTwo.size() << "\n" << AnswerTwo << "\n";
+        }
+
+        if(!Entry.is_open() || !Entry.good())
+        {
+            static std::once_flag Warned;
+            std::call_once(Warned, [&Options]()
+            {
+                std::cout << "Cannot write to result cache " << Options.CacheDir << " (" << std::strerror(errno) << "), answers are not cached" << std::endl;
+            });
+            std::remove(TemporaryPath.str().c_str());
+            return;
+        }
+    }
+
+    if(std::rename(TemporaryPath.str().c_str(), EntryPath.c_str()) != 0)
+    {
+        std::remove(TemporaryPath.str().c_str());
+        return;
+    }
+
+    ++Stores;
+}
+
+
+bool VerifyCachedResult(RunOptions& Options, const ResultCacheKey& Key, const std::string& AnswerOne, const std::string& AnswerTwo)
+{
+    std::string CachedOne {};
+    std::string CachedTwo {};
+    bool Matches {true};
+
+    if(ReadEntry(Options, Key, CachedOne, CachedTwo))
+    {
+        ++Verified;
+
+        if(CachedOne != AnswerOne || CachedTwo != AnswerTwo)
+        {
+            ++Mismatches;
+            Matches = false;
+            std::cout << "Result cache mismatch for day " << Key.Day << ": cached \"" << CachedOne << "\" / \"" << CachedTwo
+                      << "\", solved \"" << AnswerOne << "\" / \"" << AnswerTwo << "\"" << std::endl;
+        }
+    }
+
+    //Fresh answers win, they replace whatever was cached
+    StoreCachedResult(Options, Key, AnswerOne, AnswerTwo);
+
+    return Matches;
+}
+
+
+ResultCacheStatistics GetResultCacheStatistics()
+{
+    return ResultCacheStatistics {Hits.load(), Misses.load(), Stores.load(), Verified.load(), Mismatches.load()};
+}
+
+
+std::string DescribeResultCache()
+{
+    ResultCacheStatistics Statistics {GetResultCacheStatistics()};
+    if(!Statistics.Hits && !Statistics.Misses && !Statistics.Verified && !Statistics.Stores){return "";}
+
+    std::ostringstream Description;
+    Description << "Result cache: " << Statistics.Hits << " hit(s), " << Statistics.Misses << " miss(es), " << Statistics.Stores << " stored";
+    if(Statistics.Verified){Description << ", " << Statistics.Verified << " verified, " << Statistics.Mismatches << " mismatch(es)";}
+
+    return Description.str();
+}
@@ -0,0 +1,72 @@
+/*
+On-disk cache of answers, keyed by the contents of the input
+
+    Re-running a day on an input it has already solved should not cost a parse and two solves again
+    After the input is loaded, its bytes are hashed, and together with the day, the day's solver version and the engine
+    that solves it (--engine) that makes up the key:
+
+        <cache dir>/day09-v1-fast-3f2a9c0e5d7b1846-4096.result
+
+    Each engine only ever reads back its own answers, so --engine=reference always gets what the reference engine makes
+    of the input, never what the fast engine cached for it
+
+    A hit hands back both answers straight away, a miss solves as usual and stores the answers for next time
+    Bump the Version a day registers with whenever its answers could change for the same input, that orphans the
+    old entries instead of serving stale answers
+
+    Entries are written to a temporary file first and then renamed into place, rename is atomic on POSIX file systems,
+    so parallel runs (threads or processes) never see a half written entry; if two of them race to store the same key,
+    one complete entry simply replaces the other
+
+    --no-cache skips the cache altogether, --verify-cache solves anyway and reports any mismatch with what is cached
+*/
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#include "CommandLine.h"
+#include "InputLoader.h"
+
+
+struct ResultCacheKey
+{
+    int Day {0};
+    int Version {0};
+    SolverEngine Engine {EngineReference};
+    std::uint64_t Hash {0};
+    std::uint64_t Size {0};
+};
+
+
+struct ResultCacheStatistics
+{
+    std::uint64_t Hits {0};
+    std::uint64_t Misses {0};
+    std::uint64_t Stores {0};
+    std::uint64_t Verified {0};
+    std::uint64_t Mismatches {0};
+};
+
+
+//Fast non-cryptographic 64 bit hash, 32 bytes per step over four independent lanes
+std::uint64_t HashBytes(const char* p_Data, std::size_t Size);
+
+ResultCacheKey GetResultCacheKey(int Day, int Version, SolverEngine Engine, InputLines* p_InputData);
+
+//True and both answers filled in on a hit
+bool LoadCachedResult(RunOptions& Options, const ResultCacheKey& Key, std::string& AnswerOne, std::string& AnswerTwo);
+
+//Store freshly solved answers, failures to write are reported once and otherwise ignored, the cache is only an optimisation
+void StoreCachedResult(RunOptions& Options, const ResultCacheKey& Key, const std::string& AnswerOne, const std::string& AnswerTwo);
+
+//--verify-cache: compare fresh answers with the cached ones (if any), prints and counts a mismatch, then stores the fresh ones
+bool VerifyCachedResult(RunOptions& Options, const ResultCacheKey& Key, const std::string& AnswerOne, const std::string& AnswerTwo);
+
+//Process wide totals, safe to call from any thread
+ResultCacheStatistics GetResultCacheStatistics();
+
+//"Result cache: 3 hit(s), 1 miss(es), 1 stored" or an empty string if the cache was not used
+std::string DescribeResultCache();
@@ -0,0 +1,62 @@
+#include "RunArena.h"
+
+
+RunArena::RunArena(std::size_t InitialCapacity) : Capacity {InitialCapacity ? InitialCapacity : 1}
+{
+    p_FirstBlock = new std::byte[Capacity];
+    p_Blocks = new std::pmr::monotonic_buffer_resource(p_FirstBlock, Capacity, std::pmr::new_delete_resource());
+}
+
+
+RunArena::~RunArena()
+{
+    //Nothing comes after this, growing the first block now would only allocate it to free it straight away
+    Release(false);
+
+    delete p_Blocks;
+    p_Blocks = nullptr;
+    delete[] p_FirstBlock;
+    p_FirstBlock = nullptr;
+}
+
+
+void* RunArena::do_allocate(std::size_t Bytes, std::size_t Alignment)
+{
+    BytesUsed += Bytes;
+    return p_Blocks->allocate(Bytes, Alignment);
+}
+
+
+void RunArena::Release(bool Regrow)
+{
+    //Last made, first destroyed, like a stack of locals
+    for(Cleanup* p_Cleanup {p_Cleanups}; p_Cleanup; p_Cleanup = p_Cleanup->p_Next)
+    {
+        p_Cleanup->Destroy(p_Cleanup->p_Object);
+    }
+    p_Cleanups = nullptr;
+
+    //A monotonic resource cannot be given a new first block, so outgrowing it means starting over with a bigger one
+    //An eighth on top leaves room for the alignment padding that BytesUsed does not see
+    std::size_t Needed {BytesUsed + BytesUsed / 8};
+    BytesUsed = 0;
+
+    if(Needed <= Capacity || !Regrow)
+    {
+        p_Blocks->release();
+        return;
+    }
+
+    std::size_t GrownCapacity {Capacity};
+    while(GrownCapacity < Needed){GrownCapacity *= 2;}
+
+    delete p_Blocks;
+    p_Blocks = nullptr;
+    delete[] p_FirstBlock;
+
+    //Growing is only an optimisation, if the bigger block cannot be had (memory budget) keep the old size
+    p_FirstBlock = new (std::nothrow) std::byte[GrownCapacity];
+    if(p_FirstBlock){Capacity = GrownCapacity;}
+    else{p_FirstBlock = new std::byte[Capacity];}
+    p_Blocks = new std::pmr::monotonic_buffer_resource(p_FirstBlock, Capacity, std::pmr::new_delete_resource());
+}
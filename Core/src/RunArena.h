@@ -0,0 +1,76 @@
+/*
+Monotonic arena that owns everything a day builds during one run
+
+    Days used to put their parsed data together out of raw new'd maps, vectors and arrays, and take it apart again
+    piece by piece in the ParsedInput destructor. Instead, each run now gets a RunArena (RunOptions::p_Arena):
+
+        ParsedInput* p_Parsed {Options.p_Arena->Create<ParsedInput>()};
+        p_Parsed->p_RangesMap = Options.p_Arena->Create<std::pmr::map<long unsigned int, long unsigned int>>(Options.p_Arena);
+
+    Allocating is a pointer bump in the current block, freeing is a no-op. The arena is a std::pmr::memory_resource,
+    so the std::pmr containers take it as their allocator and every node and buffer they grow ends up in it too
+
+    Once both answers are in, the runner calls Release and the whole run goes in one go: destructors of non trivial
+    objects made with Create are called in reverse order (pmr containers on the arena hand nothing back, so that is
+    cheap), then every block but the first is returned
+    If the run needed more than the first block, the first block is regrown to fit the whole run, so an arena that is
+    reused (benchmark repetitions, batch inputs) settles on a single block and stops touching the heap at all
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+class RunArena : public std::pmr::memory_resource
+{
+public:
+    explicit RunArena(std::size_t InitialCapacity = 64 * 1024);
+    ~RunArena();
+
+    RunArena(const RunArena&) = delete;
+    RunArena& operator=(const RunArena&) = delete;
+
+    template<typename Object, typename... Arguments>
+    Object* Create(Arguments&&... Values)
+    {
+        Object* p_Object {new (allocate(sizeof(Object), alignof(Object))) Object(std::forward<Arguments>(Values)...)};
+
+        if constexpr(!std::is_trivially_destructible_v<Object>)
+        {
+            p_Cleanups = new (allocate(sizeof(Cleanup), alignof(Cleanup))) Cleanup {[](void* p_Destroy){((Object*)p_Destroy)->~Object();}, p_Object, p_Cleanups};
+        }
+
+        return p_Object;
+    }
+
+    //Destroy everything made with Create and drop all allocations, the arena is ready for the next run
+    //A run that was given up on (out of memory budget) passes false, it should not decide the size of the next one
+    void Release(bool Regrow = true);
+
+    //Bytes handed out since the last Release, and the size of the first block
+    std::size_t GetBytesUsed() const {return BytesUsed;}
+    std::size_t GetCapacity() const {return Capacity;}
+
+private:
+    struct Cleanup
+    {
+        void (*Destroy)(void*) {nullptr};
+        void* p_Object {nullptr};
+        Cleanup* p_Next {nullptr};
+    };
+
+    void* do_allocate(std::size_t Bytes, std::size_t Alignment) override;
+    void do_deallocate(void* p_Memory, std::size_t Bytes, std::size_t Alignment) override {}
+    bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override {return this == &Other;}
+
+    std::byte* p_FirstBlock {nullptr};
+    std::size_t Capacity {0};
+    std::pmr::monotonic_buffer_resource* p_Blocks {nullptr};
+    Cleanup* p_Cleanups {nullptr};
+    std::size_t BytesUsed {0};
+};
@@ -0,0 +1,284 @@
+#include "SolverRegistry.h"
+
+#include <iostream>
+#include <algorithm>
+
+#include "Timing.h"
+#include "PhaseRecorder.h"
+#include "ResultCache.h"
+#include "CompiledInput.h"
+
+
+std::vector<DaySolver>& GetSolvers()
+{
+    //Function local static, so registering from other translation units' statics is safe regardless of init order
+    static std::vector<DaySolver> Solvers {};
+    return Solvers;
+}
+
+
+bool RegisterSolver(DaySolver Solver)
+{
+    std::vector<DaySolver>& Solvers {GetSolvers()};
+    Solvers.emplace_back(Solver);
+
+    //Keep them ordered by day
+    std::sort(Solvers.begin(), Solvers.end(), [](const DaySolver& A, const DaySolver& B){return A.Day < B.Day;});
+
+    return true;
+}
+
+
+bool RegisterStreamingDay(int Day, void (*Stream)(RunOptions&, LineStream&, std::string&, std::string&))
+{
+    DaySolver* p_Solver {FindSolver(Day)};
+    if(!p_Solver){return false;}
+
+    p_Solver->Stream = Stream;
+
+    return true;
+}
+
+
+bool RegisterQueryDay(int Day, bool (*Query)(RunOptions&, InputLines*, std::vector<std::string>&))
+{
+    DaySolver* p_Solver {FindSolver(Day)};
+    if(!p_Solver){return false;}
+
+    p_Solver->Query = Query;
+
+    return true;
+}
+
+
+bool RegisterResumableDay(int Day, bool (*Resume)(RunOptions&, std::string_view, std::string&, std::size_t&, std::string&, std::string&))
+{
+    DaySolver* p_Solver {FindSolver(Day)};
+    if(!p_Solver){return false;}
+
+    p_Solver->Resume = Resume;
+
+    return true;
+}
+
+
+DaySolver* FindSolver(int Day)
+{
+    for(DaySolver& Solver : GetSolvers())
+    {
+        if(Solver.Day == Day){return &Solver;}
+    }
+
+    return nullptr;
+}
+
+
+DaySolver SelectEngine(DaySolver& Solver, SolverEngine Engine)
+{
+    DaySolver Selected {Solver};
+    if(Engine == EngineReference || !Solver.FastParse){return Selected;}
+
+    Selected.Parse = Solver.FastParse;
+    Selected.SolveOne = Solver.FastSolveOne;
+    Selected.SolveTwo = Solver.FastSolveTwo;
+    Selected.Reload = Solver.FastReload;
+    Selected.WholeInput = Solver.FastWholeInput;
+    Selected.Engine = EngineFast;
+
+    //Compiled inputs hold the reference engine's data, only the reference writes them
+    Selected.Compile = nullptr;
+
+    return Selected;
+}
+
+
+int RunSolver(DaySolver& Solver, RunOptions& Options)
+{
+    //Wall time for the whole run, clock() would only count CPU time
+    Stopwatch TotalRuntime {};
+    PhaseRecorder Recorder(Options);
+
+    if(Options.Timed){PrintTimeNow();}
+
+    //Same input bytes, same day, same solver version, same engine: the answers are already known
+    //Debug runs always solve, the point of those is the output along the way
+    bool UseCache {Options.Cache != CacheBypass && !Options.Debug};
+    ResultCacheKey CacheKey {};
+    std::string CachedOne {};
+    std::string CachedTwo {};
+    bool CacheHit {false};
+
+    //The Puzzle Input Data as a POINTER to a memory mapped index of lines, or to a compiled input
+    //Hashing it and looking it up in the cache counts as part of loading it
+    bool Compiled {false};
+    InputLines* p_InputData {nullptr};
+    try
+    {
+        Recorder.Begin("load");
+        p_InputData = LoadSolverInput(Solver, Options, Compiled);
+        if(UseCache && (Compiled || !p_InputData->empty()))
+        {
+            CacheKey = GetResultCacheKey(Solver.Day, Solver.Version, Solver.Engine, p_InputData);
+            CacheHit = Options.Cache == CacheUse && LoadCachedResult(Options, CacheKey, CachedOne, CachedTwo);
+        }
+        Recorder.End();
+    }
+    catch(MemoryBudgetExceeded& Exceeded)
+    {
+        Recorder.Abandon(Exceeded);
+        delete p_InputData;
+        return 1;
+    }
+
+    if(!Compiled && p_InputData->empty())
+    {
+        std::cout << "No input to process" << std::endl;
+        delete p_InputData;
+        return 1;
+    }
+
+    if(CacheHit)
+    {
+        std::cout << "Problem One:\n" << CachedOne << "\n";
+        std::cout << "Problem Two:\n" << CachedTwo << "\n";
+
+        delete p_InputData;
+        p_InputData = nullptr;
+
+        if(Options.Counters || Options.Allocations || Options.Memory){Recorder.PrintReport();}
+        if(Options.Timed){std::cout << "\n" << DescribeResultCache() << "\n";}
+
+        std::cout << "\nTotal runtime: " << TotalRuntime.Seconds() << "s\n";
+
+        return 0;
+    }
+
+    //Everything the day builds from here on lives in the arena, and goes in one go once both answers are in
+    RunArena Arena {};
+    RunOptions ArenaOptions {Options};
+    ArenaOptions.p_Arena = &Arena;
+
+    //The parsed data may still point into the mapped input, so it has to go before the input does
+    std::shared_ptr<void> p_Parsed {};
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+
+    try
+    {
+        Recorder.Begin("parse");
+        p_Parsed = ParseSolverInput(Solver, ArenaOptions, p_InputData, Compiled);
+        Recorder.End();
+
+        if(!p_Parsed)
+        {
+            Arena.Release();
+            delete p_InputData;
+            return 1;
+        }
+
+        Recorder.Begin("part_one");
+        AnswerOne = Solver.SolveOne(ArenaOptions, p_Parsed.get());
+        Recorder.End();
+        std::cout << "Problem One:\n" << AnswerOne << "\n";
+
+        Recorder.Begin("part_two");
+        AnswerTwo = Solver.SolveTwo(ArenaOptions, p_Parsed.get());
+        Recorder.End();
+        std::cout << "Problem Two:\n" << AnswerTwo << "\n";
+    }
+    catch(MemoryBudgetExceeded& Exceeded)
+    {
+        Recorder.Abandon(Exceeded);
+        p_Parsed.reset();
+        Arena.Release(false);
+        delete p_InputData;
+
+        if(Options.Counters || Options.Allocations || Options.Memory){Recorder.PrintReport();}
+        return 1;
+    }
+
+    //A part the day gave no answer for is not a result, caching it would hide the day's message on every later run
+    bool Answered {!AnswerOne.empty() && !AnswerTwo.empty()};
+    if(UseCache && Options.Cache == CacheVerify){VerifyCachedResult(Options, CacheKey, AnswerOne, AnswerTwo);}
+    else if(UseCache && Answered){StoreCachedResult(Options, CacheKey, AnswerOne, AnswerTwo);}
+
+    //Cleaning up
+    p_Parsed.reset();
+    Arena.Release();
+    delete p_InputData;
+    p_InputData = nullptr;
+
+    if(Options.Counters || Options.Allocations || Options.Memory){Recorder.PrintReport();}
+    if(Options.Timed && UseCache){std::cout << "\n" << DescribeResultCache() << "\n";}
+
+    std::cout << "\nTotal runtime: " << TotalRuntime.Seconds() << "s\n";
+
+    return 0;
+}
+
+
+int RunStreamingSolver(DaySolver& Solver, RunOptions& Options)
+{
+    Stopwatch TotalRuntime {};
+
+    if(!Solver.Stream)
+    {
+        std::cout << "Day " << Solver.Day << " has no streaming mode, it needs the whole input at once" << std::endl;
+        return 1;
+    }
+
+    if(Options.Timed){PrintTimeNow();}
+
+    LineStream InputStream(Options.InputPath);
+    if(!InputStream.IsOpen()){return 1;}
+
+    std::string AnswerOne {};
+    std::string AnswerTwo {};
+    Solver.Stream(Options, InputStream, AnswerOne, AnswerTwo);
+
+    std::cout << "Problem One:\n" << AnswerOne << "\n";
+    std::cout << "Problem Two:\n" << AnswerTwo << "\n";
+
+    std::cout << "\nTotal runtime: " << TotalRuntime.Seconds() << "s\n";
+
+    return 0;
+}
+
+
+int RunQuerySolver(DaySolver& Solver, RunOptions& Options)
+{
+    Stopwatch TotalRuntime {};
+
+    if(!Solver.Query)
+    {
+        std::cout << "Day " << Solver.Day << " does not take --queries" << std::endl;
+        return 1;
+    }
+
+    if(Options.Timed){PrintTimeNow();}
+
+    //The answers depend on the queries as much as on the input, so these never go through the result cache
+    InputLines* p_InputData {MapFile(Options.InputPath)};
+    if(!p_InputData->p_Data)
+    {
+        std::cout << "No input to process" << std::endl;
+        delete p_InputData;
+        return 1;
+    }
+    p_InputData->Lines.emplace_back(p_InputData->p_Data, p_InputData->DataSize);
+
+    std::vector<std::string> Answers {};
+    bool Answered {Solver.Query(Options, p_InputData, Answers)};
+
+    delete p_InputData;
+    p_InputData = nullptr;
+
+    if(!Answered){return 1;}
+
+    std::cout << "Queries:\n";
+    for(std::string& Answer : Answers){std::cout << Answer << "\n";}
+
+    std::cout << "\nTotal runtime: " << TotalRuntime.Seconds() << "s\n";
+
+    return 0;
+}
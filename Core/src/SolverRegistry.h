@@ -0,0 +1,202 @@
+/*
+Shared solver registry for all Advent of Code 2025 C++ projects
+
+    Every day hooks its three entry points into the registry:
+
+        Parse       Turn the InputLines into whatever that day likes to work with, built in the run's RunArena
+        SolveOne    Answer problem one using the parsed data
+        SolveTwo    Answer problem two using the parsed data
+
+    The shared main (Main.cpp) then looks up the requested day and runs it, so the same day source can be linked
+    into its own ./AoC binary, or together with all other days into a single ./aoc binary
+
+    Registering is done from the bottom of each day's source file with a static:
+
+        static bool Registered {RegisterDay<Day01::ParsedInput>(1, '\n', Day01::ParseInput, Day01::AnswerProblemOne, Day01::AnswerProblemTwo)};
+
+    Days that only need a bounded window of the input can additionally register a streaming entry point,
+    which answers both problems while reading the input line by line from a LineStream (--stream):
+
+        static bool RegisteredStream {RegisterStreamingDay(1, Day01::StreamBothProblems)};
+
+    Days whose puzzle has knobs the input does not set (Day 01: where the dial starts, how many positions it has,
+    Day 03: how many batteries to turn on per bank)
+    can register a query entry point, which answers a list of such variations in one pass over the input (--queries):
+
+        static bool RegisteredQuery {RegisterQueryDay(1, Day01::AnswerQueries)};
+
+    Days whose answers can be carried forward as the input grows can register a resume entry point, which continues
+    from a saved state with only the bytes appended since (--checkpoint, see Checkpoint.h):
+
+        static bool RegisteredResume {RegisterResumableDay(1, Day01::ResumeBothProblems)};
+
+    Likewise, days can register a compile and reload pair to skip parsing on pre-parsed inputs, see CompiledInput.h
+
+    The three entry points of RegisterDay are the day's reference engine. An optimised implementation is registered
+    next to it as the fast engine, with its own parsed data, and --engine=fast|reference|both picks between them:
+
+        static bool RegisteredFast {RegisterFastEngine<Day05::FastInput>(5, Day05::FastParseInput, Day05::FastAnswerProblemOne, Day05::FastAnswerProblemTwo)};
+
+    A fast engine that scans the raw bytes itself can pass WholeInput, it then gets the whole input as its only line
+    instead of a line index it would never use (Day 01)
+
+    The reference stays around to check the fast engine against (EngineComparison.h), so it is never "cleaned up"
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include "InputLoader.h"
+#include "LineStream.h"
+#include "CommandLine.h"
+#include "RunArena.h"
+
+
+struct CompiledWriter;
+struct CompiledReader;
+
+
+struct DaySolver
+{
+    int Day {0};
+    char Delimiter {'\n'};      //Passed on to GetFileData, Day 02 splits on ','
+    bool WholeInput {false};    //Skip the line index, Parse gets the whole mapping as a single line
+    int ExpectedCost {1};       //Rough relative runtime, the all-days runner starts the expensive days first
+    int Version {1};            //Part of the result cache key, bump it when the answers for the same input could change
+    SolverEngine Engine {EngineReference};      //Whose entry points these are, SelectEngine swaps in the fast ones, also part of the key
+
+    //The parsed data is type erased, it lives in the run's arena (RunOptions::p_Arena), which also takes it down again
+    std::function<std::shared_ptr<void>(RunOptions&, InputLines*)> Parse {};
+    std::function<std::string(RunOptions&, void*)> SolveOne {};
+    std::function<std::string(RunOptions&, void*)> SolveTwo {};
+
+    //Optional, answers both problems in one pass over a LineStream without holding on to the whole input
+    std::function<void(RunOptions&, LineStream&, std::string&, std::string&)> Stream {};
+
+    //Optional, answers every query in RunOptions::Queries from the whole input (its only line), one line of text per query
+    //Returns false if the queries make no sense to the day
+    std::function<bool(RunOptions&, InputLines*, std::vector<std::string>&)> Query {};
+
+    //Optional, carries State (empty for a fresh start) forward over NewInput, then saves the state after the last complete
+    //line in it back into State and sets Used to where that line ends; the answers include any incomplete line after it
+    //Returns false if State makes no sense to the day
+    std::function<bool(RunOptions&, std::string_view, std::string&, std::size_t&, std::string&, std::string&)> Resume {};
+
+    //Optional, write the parsed data to a compiled input and rebuild it from one (CompiledInput.h)
+    std::function<void(void*, CompiledWriter&)> Compile {};
+    std::function<std::shared_ptr<void>(RunOptions&, CompiledReader&)> Reload {};
+
+    //Optional, the fast engine (--engine), the entry points above are the reference engine
+    //Compiled inputs are always written by the reference, FastReload reads that same payload into the fast engine's data
+    std::function<std::shared_ptr<void>(RunOptions&, InputLines*)> FastParse {};
+    std::function<std::string(RunOptions&, void*)> FastSolveOne {};
+    std::function<std::string(RunOptions&, void*)> FastSolveTwo {};
+    std::function<std::shared_ptr<void>(RunOptions&, CompiledReader&)> FastReload {};
+    bool FastWholeInput {false};
+};
+
+
+//All registered days, sorted by day number
+std::vector<DaySolver>& GetSolvers();
+
+//Add a day to the registry, returns true so it can be used to initialise a static
+bool RegisterSolver(DaySolver Solver);
+
+//Attach a streaming entry point to an already registered day, register it after RegisterDay in the same file
+bool RegisterStreamingDay(int Day, void (*Stream)(RunOptions&, LineStream&, std::string&, std::string&));
+
+//Attach a query entry point to an already registered day, same idea as RegisterStreamingDay
+bool RegisterQueryDay(int Day, bool (*Query)(RunOptions&, InputLines*, std::vector<std::string>&));
+
+//Attach a resume entry point to an already registered day, same idea as RegisterStreamingDay
+bool RegisterResumableDay(int Day, bool (*Resume)(RunOptions&, std::string_view, std::string&, std::size_t&, std::string&, std::string&));
+
+//Look up a day, nullptr if it was not linked in
+DaySolver* FindSolver(int Day);
+
+//The solver as the runners should see it for the chosen engine, the fast entry points swapped in where there are any
+DaySolver SelectEngine(DaySolver& Solver, SolverEngine Engine);
+
+//Load, parse and solve a single day with the given options, printing the answers like the old per-day mains did
+int RunSolver(DaySolver& Solver, RunOptions& Options);
+
+//Same as RunSolver, but feeds the input through the day's streaming entry point in constant memory
+int RunStreamingSolver(DaySolver& Solver, RunOptions& Options);
+
+
+//Answer the --queries list through the day's query entry point, with the input mapped but not split into lines
+int RunQuerySolver(DaySolver& Solver, RunOptions& Options);
+
+
+template<typename ParsedData>
+bool RegisterDay(int Day, char Delimiter,
+                 ParsedData* (*Parse)(RunOptions&, InputLines*),
+                 std::string (*SolveOne)(RunOptions&, ParsedData*),
+                 std::string (*SolveTwo)(RunOptions&, ParsedData*),
+                 int ExpectedCost = 1,
+                 int Version = 1)
+{
+    //Typed front end for RegisterSolver, wraps the day's own functions so they can be stored side by side
+
+    DaySolver Solver {};
+    Solver.Day = Day;
+    Solver.Delimiter = Delimiter;
+    Solver.ExpectedCost = ExpectedCost;
+    Solver.Version = Version;
+    Solver.Parse = [Parse](RunOptions& Options, InputLines* p_InputData)
+    {
+        //The arena owns the parsed data, the shared_ptr only tracks whether there is any
+        return std::shared_ptr<void>(Parse(Options, p_InputData), [](ParsedData*){});
+    };
+    Solver.SolveOne = [SolveOne](RunOptions& Options, void* p_Parsed)
+    {
+        return SolveOne(Options, (ParsedData*)p_Parsed);
+    };
+    Solver.SolveTwo = [SolveTwo](RunOptions& Options, void* p_Parsed)
+    {
+        return SolveTwo(Options, (ParsedData*)p_Parsed);
+    };
+
+    return RegisterSolver(Solver);
+}
+
+
+template<typename ParsedData>
+bool RegisterFastEngine(int Day,
+                        ParsedData* (*Parse)(RunOptions&, InputLines*),
+                        std::string (*SolveOne)(RunOptions&, ParsedData*),
+                        std::string (*SolveTwo)(RunOptions&, ParsedData*),
+                        ParsedData* (*Reload)(RunOptions&, CompiledReader&) = nullptr,
+                        bool WholeInput = false)
+{
+    //Attach a fast engine to an already registered day, same idea as RegisterStreamingDay
+    DaySolver* p_Solver {FindSolver(Day)};
+    if(!p_Solver){return false;}
+
+    p_Solver->FastParse = [Parse](RunOptions& Options, InputLines* p_InputData)
+    {
+        return std::shared_ptr<void>(Parse(Options, p_InputData), [](ParsedData*){});
+    };
+    p_Solver->FastSolveOne = [SolveOne](RunOptions& Options, void* p_Parsed)
+    {
+        return SolveOne(Options, (ParsedData*)p_Parsed);
+    };
+    p_Solver->FastSolveTwo = [SolveTwo](RunOptions& Options, void* p_Parsed)
+    {
+        return SolveTwo(Options, (ParsedData*)p_Parsed);
+    };
+    p_Solver->FastWholeInput = WholeInput;
+    if(Reload)
+    {
+        p_Solver->FastReload = [Reload](RunOptions& Options, CompiledReader& Reader)
+        {
+            return std::shared_ptr<void>(Reload(Options, Reader), [](ParsedData*){});
+        };
+    }
+
+    return true;
+}
@@ -0,0 +1,130 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <string>
+
+#include "Trace.h"
+
+
+ThreadPool::ThreadPool(int ThreadCount)
+{
+    if(ThreadCount <= 0){ThreadCount = std::max(1, (int)std::thread::hardware_concurrency());}
+
+    for(int i_Worker {0}; i_Worker < ThreadCount; ++i_Worker)
+    {
+        Queues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    //Only start the threads once all queues exist, workers look at each other's queues straight away
+    for(int i_Worker {0}; i_Worker < ThreadCount; ++i_Worker)
+    {
+        Workers.emplace_back(&ThreadPool::WorkerLoop, this, i_Worker);
+    }
+}
+
+
+ThreadPool::~ThreadPool()
+{
+    Stopping = true;
+    {
+        //A worker between checking Stopping and going to sleep holds the lock, so it cannot miss the wake up
+        std::lock_guard<std::mutex> Guard(SleepLock);
+    }
+    WorkAvailable.notify_all();
+
+    for(std::thread& Worker : Workers){Worker.join();}
+}
+
+
+void ThreadPool::Submit(std::function<void()> Task)
+{
+    //Counted before it can run, so Wait never sees it finished before it was submitted
+    ++Pending;
+
+    WorkerQueue& Queue {*Queues[NextQueue.fetch_add(1) % Queues.size()]};
+    {
+        std::lock_guard<std::mutex> QueueGuard(Queue.Lock);
+        Queue.Tasks.emplace_back(std::move(Task));
+    }
+
+    //A worker counts itself as Sleeping before it looks at Queued, so either it sees this task or this sees it
+    ++Queued;
+    if(Sleeping > 0)
+    {
+        {
+            std::lock_guard<std::mutex> Guard(SleepLock);
+        }
+        WorkAvailable.notify_one();
+    }
+}
+
+
+void ThreadPool::Wait()
+{
+    std::unique_lock<std::mutex> Guard(DoneLock);
+    AllDone.wait(Guard, [this]{return Pending == 0;});
+}
+
+
+bool ThreadPool::TryTakeTask(int Worker, std::function<void()>& Task)
+{
+    int QueueCount {(int)Queues.size()};
+
+    //Own queue first (front), then everybody else's (back)
+    for(int i_Offset {0}; i_Offset < QueueCount; ++i_Offset)
+    {
+        WorkerQueue& Queue {*Queues[(Worker + i_Offset) % QueueCount]};
+        std::lock_guard<std::mutex> QueueGuard(Queue.Lock);
+
+        if(Queue.Tasks.empty()){continue;}
+
+        if(i_Offset == 0)
+        {
+            Task = std::move(Queue.Tasks.front());
+            Queue.Tasks.pop_front();
+        }
+        else
+        {
+            Task = std::move(Queue.Tasks.back());
+            Queue.Tasks.pop_back();
+        }
+
+        --Queued;
+        return true;
+    }
+
+    return false;
+}
+
+
+void ThreadPool::WorkerLoop(int Worker)
+{
+    if(TracingEnabled()){SetTraceThreadName("pool worker " + std::to_string(Worker));}
+
+    while(true)
+    {
+        std::function<void()> Task {};
+        if(TryTakeTask(Worker, Task))
+        {
+            Task();
+
+            if(--Pending == 0)
+            {
+                {
+                    std::lock_guard<std::mutex> Guard(DoneLock);
+                }
+                AllDone.notify_all();
+            }
+
+            continue;
+        }
+
+        //Nothing in any of the queues, sleep until a Submit or until the pool shuts down
+        std::unique_lock<std::mutex> Guard(SleepLock);
+        ++Sleeping;
+        WorkAvailable.wait(Guard, [this]{return Stopping || Queued > 0;});
+        --Sleeping;
+
+        if(Stopping && Queued <= 0){return;}
+    }
+}
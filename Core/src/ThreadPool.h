@@ -0,0 +1,69 @@
+/*
+Work-stealing thread pool shared by everything in aoc_core that wants to run on more than one core
+
+    Every worker owns a deque of tasks
+        - New tasks are handed out round robin, in the order they were submitted
+        - A worker takes from the FRONT of its own deque
+        - When its own deque is empty it steals from the BACK of another worker's deque
+
+    Submitting the most expensive tasks first therefore puts them at the front of the workers' deques,
+    while the cheap tasks at the back are the ones that get stolen by idle workers
+
+    Handing out, taking and stealing a task only locks the one deque it is in, the counts are atomic
+    The pool wide locks are only there to fall asleep on, a Submit only touches one when a worker is asleep
+*/
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+
+class ThreadPool
+{
+public:
+    //0 threads means one per hardware thread
+    explicit ThreadPool(int ThreadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> Task);
+
+    //Block until every submitted task has finished running
+    void Wait();
+
+    int GetThreadCount() const {return (int)Workers.size();}
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex Lock;
+        std::deque<std::function<void()>> Tasks;
+    };
+
+    bool TryTakeTask(int Worker, std::function<void()>& Task);
+    void WorkerLoop(int Worker);
+
+    std::vector<std::unique_ptr<WorkerQueue>> Queues {};
+    std::vector<std::thread> Workers {};
+
+    std::atomic<unsigned> NextQueue {0};    //Round robin target for the next Submit
+    std::atomic<int> Queued {0};            //Tasks sitting in a deque, briefly off by the ones being pushed or popped
+    std::atomic<int> Pending {0};           //Tasks submitted but not yet finished
+    std::atomic<int> Sleeping {0};          //Workers waiting on WorkAvailable, or about to
+    std::atomic<bool> Stopping {false};
+
+    //Only held to sleep and to wake the sleepers, never to hand out or take a task
+    std::mutex SleepLock;
+    std::condition_variable WorkAvailable;
+    std::mutex DoneLock;
+    std::condition_variable AllDone;
+};
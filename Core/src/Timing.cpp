@@ -0,0 +1,16 @@
+#include "Timing.h"
+
+#include <iostream>
+#include <ctime>
+
+
+void PrintTimeNow()
+{
+    //Function to print specific time points if required
+
+    std::time_t Now;
+    struct tm* Local;
+    std::time(&Now);
+    Local = std::localtime(&Now);
+    std::cout << std::asctime(Local); 
+}
@@ -0,0 +1,24 @@
+/*
+Shared timing helpers for all Advent of Code 2025 C++ projects
+
+    PrintTimeNow marks phase boundaries in human readable form (one second resolution)
+    Stopwatch measures wall time with steady_clock for anything that needs actual numbers
+*/
+
+#pragma once
+
+#include <chrono>
+
+
+//Print the current wall clock time, used to mark the start and end of each phase when a run is timed
+void PrintTimeNow();
+
+
+struct Stopwatch
+{
+    //Starts running as soon as it is created
+    std::chrono::steady_clock::time_point Start {std::chrono::steady_clock::now()};
+
+    void Restart() {Start = std::chrono::steady_clock::now();}
+    double Seconds() const {return std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();}
+};
@@ -0,0 +1,205 @@
+#include "Trace.h"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <algorithm>
+
+
+std::atomic<bool> TracingActive {false};
+
+
+namespace
+{
+    constexpr int TraceBufferSize {16384};      //Spans per thread, about 1.2 MB per traced thread
+    constexpr int TraceNameSize {48};
+
+    struct TraceEvent
+    {
+        char Name[TraceNameSize] {};
+        const char* Category {nullptr};
+        std::uint64_t Start {0};
+        std::uint64_t Duration {0};
+    };
+
+    struct TraceBuffer
+    {
+        TraceEvent Events[TraceBufferSize] {};
+        std::atomic<std::uint64_t> Written {0};     //Total ever recorded, the ring holds the last TraceBufferSize of them
+        char ThreadName[TraceNameSize] {};
+        int ThreadIndex {0};
+        TraceBuffer* p_Next {nullptr};
+    };
+
+    std::chrono::steady_clock::time_point TraceEpoch {};
+
+    //Every thread's buffer, pushed on the front as threads record their first span
+    std::atomic<TraceBuffer*> p_TraceBuffers {nullptr};
+    std::atomic<int> TraceThreadCount {0};
+    std::atomic<std::uint64_t> UnbufferedSpans {0};     //Recorded on a thread that could not get a buffer
+
+    //Never freed, pool threads are gone by the time the trace is written but their spans are not
+    thread_local TraceBuffer* p_ThreadBuffer {nullptr};
+
+
+    void CopyTraceName(char (&Destination)[TraceNameSize], std::string_view Name)
+    {
+        std::size_t Length {std::min(Name.size(), (std::size_t)TraceNameSize - 1)};
+        std::memcpy(Destination, Name.data(), Length);
+        Destination[Length] = '\0';
+    }
+
+
+    TraceBuffer* GetThreadBuffer() noexcept
+    {
+        if(p_ThreadBuffer){return p_ThreadBuffer;}
+
+        //Not through operator new, which counts towards --allocations and throws once over --memory-budget
+        void* p_Memory {std::calloc(1, sizeof(TraceBuffer))};
+        if(!p_Memory){return nullptr;}
+
+        TraceBuffer* p_Buffer {new(p_Memory) TraceBuffer};
+        p_Buffer->ThreadIndex = ++TraceThreadCount;
+
+        p_Buffer->p_Next = p_TraceBuffers.load(std::memory_order_relaxed);
+        while(!p_TraceBuffers.compare_exchange_weak(p_Buffer->p_Next, p_Buffer, std::memory_order_release, std::memory_order_relaxed)){}
+
+        p_ThreadBuffer = p_Buffer;
+        return p_Buffer;
+    }
+
+
+    void WriteTraceString(std::ostream& Output, const char* Text)
+    {
+        //Span names come from the code and the thread names from us, only quotes and backslashes need care
+        Output << '"';
+        for(const char* p_Char {Text}; *p_Char; ++p_Char)
+        {
+            if(*p_Char == '"' || *p_Char == '\\'){Output << '\\';}
+            if((unsigned char)*p_Char >= 0x20){Output << *p_Char;}
+        }
+        Output << '"';
+    }
+
+
+    void WriteTraceMicroseconds(std::ostream& Output, std::uint64_t Nanoseconds)
+    {
+        //The Chrome trace format counts in microseconds, keep the nanoseconds as decimals
+        Output << Nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << Nanoseconds % 1000 << std::setfill(' ');
+    }
+}
+
+
+void EnableTracing()
+{
+    if(TracingActive.load()){return;}
+
+    TraceEpoch = std::chrono::steady_clock::now();
+    TracingActive.store(true);
+
+    //The enabling thread has its buffer before it records anything
+    GetThreadBuffer();
+}
+
+
+std::uint64_t GetTraceTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - TraceEpoch).count();
+}
+
+
+void RecordTraceSpan(std::string_view Name, const char* Category, std::uint64_t Start, std::uint64_t End) noexcept
+{
+    TraceBuffer* p_Buffer {GetThreadBuffer()};
+    if(!p_Buffer)
+    {
+        UnbufferedSpans.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    //Only this thread ever writes the buffer, so a plain load and a release store are enough
+    std::uint64_t Written {p_Buffer->Written.load(std::memory_order_relaxed)};
+    TraceEvent& Event {p_Buffer->Events[Written % TraceBufferSize]};
+
+    CopyTraceName(Event.Name, Name);
+    Event.Category = Category;
+    Event.Start = Start;
+    Event.Duration = End > Start ? End - Start : 0;
+
+    p_Buffer->Written.store(Written + 1, std::memory_order_release);
+}
+
+
+void SetTraceThreadName(std::string_view Name)
+{
+    if(!TracingEnabled()){return;}
+
+    //Also where pool workers get their buffer, before they run anything
+    TraceBuffer* p_Buffer {GetThreadBuffer()};
+    if(p_Buffer){CopyTraceName(p_Buffer->ThreadName, Name);}
+}
+
+
+bool WriteTrace(std::string Path)
+{
+    std::ofstream Output(Path);
+    if(!Output.is_open())
+    {
+        std::cout << "Cannot open " << Path << " for writing the trace" << std::endl;
+        return false;
+    }
+
+    Output << "{\"traceEvents\":[\n";
+    bool First {true};
+    std::uint64_t Dropped {UnbufferedSpans.load(std::memory_order_relaxed)};
+
+    for(TraceBuffer* p_Buffer {p_TraceBuffers.load(std::memory_order_acquire)}; p_Buffer; p_Buffer = p_Buffer->p_Next)
+    {
+        std::uint64_t Written {p_Buffer->Written.load(std::memory_order_acquire)};
+        std::uint64_t Oldest {Written > TraceBufferSize ? Written - TraceBufferSize : 0};
+        Dropped += Oldest;
+
+        if(p_Buffer->ThreadName[0])
+        {
+            Output << (First ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << p_Buffer->ThreadIndex
+                   << ",\"args\":{\"name\":";
+            WriteTraceString(Output, p_Buffer->ThreadName);
+            Output << "}}";
+            First = false;
+        }
+
+        for(std::uint64_t i_Event {Oldest}; i_Event < Written; ++i_Event)
+        {
+            TraceEvent& Event {p_Buffer->Events[i_Event % TraceBufferSize]};
+
+            Output << (First ? "" : ",\n") << "{\"name\":";
+            WriteTraceString(Output, Event.Name);
+            Output << ",\"cat\":";
+            WriteTraceString(Output, Event.Category);
+            Output << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << p_Buffer->ThreadIndex << ",\"ts\":";
+            WriteTraceMicroseconds(Output, Event.Start);
+            Output << ",\"dur\":";
+            WriteTraceMicroseconds(Output, Event.Duration);
+            Output << "}";
+            First = false;
+        }
+    }
+
+    Output << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_spans\":" << Dropped << "}}\n";
+
+    if(!Output.good())
+    {
+        std::cout << "Failed writing the trace to " << Path << std::endl;
+        return false;
+    }
+
+    std::uint64_t Unbuffered {UnbufferedSpans.load(std::memory_order_relaxed)};
+    if(Dropped > Unbuffered){std::cout << "Trace buffers overflowed, the oldest " << Dropped - Unbuffered << " span(s) were dropped" << std::endl;}
+    if(Unbuffered){std::cout << "No trace buffer could be allocated for some threads, " << Unbuffered << " span(s) were dropped" << std::endl;}
+
+    return true;
+}
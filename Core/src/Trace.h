@@ -0,0 +1,73 @@
+/*
+Timeline tracing (--trace=FILE)
+
+    PrintTimeNow only says when a phase started, one line at a time on stdout, and says nothing about which thread it
+    ran on. With --trace=FILE every phase (and a couple of interesting steps inside the days) is recorded as a span,
+    and when the run is over they are all written as a Chrome trace:
+
+        ./aoc --all --trace=all.json                 then open all.json in https://ui.perfetto.dev or chrome://tracing
+
+    Spans are recorded with a scoped TraceSpan, or by PhaseRecorder for the load/parse/part_one/part_two phases:
+
+        {
+            TraceSpan Span {"GenerateManualLines"};
+            ...
+        }
+
+    Every thread writes into its own fixed size ring buffer, no locks and no allocation on the way; when a buffer is
+    full the oldest spans are overwritten (the count of lost spans ends up in the trace metadata). Buffers are only
+    created once tracing is enabled, before that a TraceSpan costs one relaxed atomic load and a branch
+    A thread gets its buffer when tracing is enabled on it or when it names itself, a thread that does neither at its
+    first span. They come straight from calloc, so they never show up in --allocations or count against
+    --memory-budget, and recording a span cannot throw: a thread that cannot get a buffer loses its spans instead
+
+    Names are copied into the span (up to 47 characters), so they do not need to outlive it
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+//Set by EnableTracing, read inline so a disabled TraceSpan stays next to free
+extern std::atomic<bool> TracingActive;
+
+inline bool TracingEnabled() {return TracingActive.load(std::memory_order_relaxed);}
+
+void EnableTracing();
+
+//Nanoseconds on the steady clock since tracing was enabled
+std::uint64_t GetTraceTimestamp();
+
+//Add a finished span to the calling thread's buffer
+void RecordTraceSpan(std::string_view Name, const char* Category, std::uint64_t Start, std::uint64_t End) noexcept;
+
+//Label the calling thread in the timeline, "main", "pool worker 3"
+void SetTraceThreadName(std::string_view Name);
+
+//Write every thread's spans as Chrome trace JSON, only call this once all traced threads are done
+bool WriteTrace(std::string Path);
+
+
+struct TraceSpan
+{
+    explicit TraceSpan(const char* SpanName, const char* SpanCategory = "day") : Name {SpanName}, Category {SpanCategory}
+    {
+        if(TracingEnabled()){Start = GetTraceTimestamp();}
+    }
+
+    ~TraceSpan()
+    {
+        if(TracingEnabled()){RecordTraceSpan(Name, Category, Start, GetTraceTimestamp());}
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    const char* Name {nullptr};
+    const char* Category {nullptr};
+    std::uint64_t Start {0};
+};
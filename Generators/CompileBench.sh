@@ -0,0 +1,48 @@
+#!/bin/bash
+#Parse vs reload benchmark: generate an input for one day, compile it, then benchmark both the text and the compiled form
+#
+#   ./CompileBench.sh <day> <size>
+#
+#   Environment:
+#       REPETITIONS   benchmark repetitions per form (default 3)
+#       GEN_OPTIONS   extra shape options for GenerateInput, i.e. GEN_OPTIONS="--ids=1000000"
+#       WORK_DIR      where the generated inputs go (default ./sweep)
+#
+#   Prints one row per form with the file size and the median load and parse times
+
+set -e
+
+Day=$1
+Size=$2
+if [ -z "$Day" ] || [ -z "$Size" ]; then
+    echo "Usage: $0 <day> <size>"
+    exit 1
+fi
+
+Here=$(cd "$(dirname "$0")" && pwd)
+Root=$(cd "$Here/.." && pwd)
+Repetitions=${REPETITIONS:-3}
+WorkDir=${WORK_DIR:-$Here/sweep}
+DayName=$(printf "day%02d" "$Day")
+
+make -s -C "$Here"
+make -s -C "$Root"
+mkdir -p "$WorkDir"
+
+Input="$WorkDir/$DayName-$Size.txt"
+# shellcheck disable=SC2086
+"$Here/GenerateInput" --day="$Day" --size="$Size" $GEN_OPTIONS --output="$Input"
+"$Root/aoc" --day="$Day" --compile-input "$Input"
+
+#Pull the median of a phase out of a single line JSON record
+Median() { sed -n "s/.*\"name\":\"$1\",\"min_ns\":[0-9]*,\"median_ns\":\([0-9]*\).*/\1/p" <<< "$2"; }
+
+printf "%-8s %12s %14s %14s\n" "form" "bytes" "load (ms)" "parse (ms)"
+for Form in text compiled; do
+    File="$Input"
+    if [ "$Form" = compiled ]; then File="$Input.bin"; fi
+
+    Record=$("$Root/aoc" --day="$Day" --bench="$Repetitions" --warmup=1 --json "$File")
+    awk -v F="$Form" -v B="$(stat -c %s "$File")" -v L="$(Median load "$Record")" -v P="$(Median parse "$Record")" \
+        'BEGIN {printf "%-8s %12d %14.3f %14.3f\n", F, B, L / 1e6, P / 1e6}'
+done
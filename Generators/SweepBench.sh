@@ -0,0 +1,82 @@
+#!/bin/bash
+#Stress benchmark: generate inputs of growing size for one day, benchmark each, and collect throughput numbers
+#
+#   ./SweepBench.sh <day> [size ...]
+#
+#   Environment:
+#       REPETITIONS   benchmark repetitions per size (default 5)
+#       GEN_OPTIONS   extra shape options for GenerateInput, i.e. GEN_OPTIONS="--overlap=0.5"
+#       WORK_DIR      where the generated inputs and results go (default ./sweep)
+#
+#   Writes WORK_DIR/dayNN.jsonl (raw ./aoc --json records) and WORK_DIR/dayNN.csv (one row per size)
+#   If gnuplot is installed the throughput curve is rendered to WORK_DIR/dayNN.png
+
+set -e
+
+Day=$1
+if [ -z "$Day" ]; then
+    echo "Usage: $0 <day> [size ...]"
+    exit 1
+fi
+shift
+
+Sizes=("$@")
+if [ ${#Sizes[@]} -eq 0 ]; then Sizes=(1000 10000 100000 1000000); fi
+
+Here=$(cd "$(dirname "$0")" && pwd)
+Root=$(cd "$Here/.." && pwd)
+Repetitions=${REPETITIONS:-5}
+WorkDir=${WORK_DIR:-$Here/sweep}
+DayName=$(printf "day%02d" "$Day")
+
+make -s -C "$Here"
+make -s -C "$Root"
+mkdir -p "$WorkDir"
+
+Json="$WorkDir/$DayName.jsonl"
+Csv="$WorkDir/$DayName.csv"
+: > "$Json"
+echo "size,bytes,load_ns,parse_ns,part_one_ns,part_two_ns,total_ns,mib_per_s,size_per_s" > "$Csv"
+
+#Pull the median of a phase out of a single line JSON record
+Median() { sed -n "s/.*\"name\":\"$1\",\"min_ns\":[0-9]*,\"median_ns\":\([0-9]*\).*/\1/p" <<< "$2"; }
+
+for Size in "${Sizes[@]}"; do
+    Input="$WorkDir/$DayName-$Size.txt"
+    # shellcheck disable=SC2086
+    "$Here/GenerateInput" --day="$Day" --size="$Size" $GEN_OPTIONS --output="$Input"
+    Bytes=$(stat -c %s "$Input")
+
+    Record=$("$Root/aoc" --day="$Day" --bench="$Repetitions" --warmup=1 --json "$Input")
+    echo "$Record" >> "$Json"
+
+    Load=$(Median load "$Record")
+    Parse=$(Median parse "$Record")
+    One=$(Median part_one "$Record")
+    Two=$(Median part_two "$Record")
+    Total=$((Load + Parse + One + Two))
+
+    awk -v S="$Size" -v B="$Bytes" -v L="$Load" -v P="$Parse" -v O="$One" -v T="$Two" -v A="$Total" 'BEGIN {
+        Seconds = (A > 0 ? A : 1) / 1e9
+        printf "%s,%s,%s,%s,%s,%s,%s,%.3f,%.1f\n", S, B, L, P, O, T, A, B / 1048576 / Seconds, S / Seconds
+    }' >> "$Csv"
+
+    echo "day $Day size $Size: $(tail -n 1 "$Csv")"
+    rm -f "$Input"
+done
+
+if command -v gnuplot > /dev/null; then
+    gnuplot <<PLOT
+set terminal png size 900,600
+set output "$WorkDir/$DayName.png"
+set datafile separator ","
+set logscale x
+set xlabel "--size"
+set ylabel "size units per second"
+set title "Day $Day throughput"
+plot "$Csv" using 1:9 skip 1 with linespoints title "throughput"
+PLOT
+    echo "Plot written to $WorkDir/$DayName.png"
+else
+    echo "gnuplot not found, raw numbers are in $Csv"
+fi
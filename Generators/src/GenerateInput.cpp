@@ -0,0 +1,503 @@
+/*
+Synthetic input generator for the Advent of Code 2025 days
+
+    The real puzzle inputs are tiny, this produces valid inputs of any size so the scaling behaviour of each day
+    can actually be seen. Output goes to stdout (or --output=FILE), so it can be piped straight into a solver
+
+        ./GenerateInput --day=5 --size=1000000 --overlap=0.3 > big05.txt
+
+    --size is the main knob, what it counts depends on the day (see the table below), every other option
+    shapes the input without changing its size
+
+        Day   --size counts                  Shape options
+        01    rotations (lines)              --max-clicks=N     largest single rotation
+        02    ranges                         --digits=N         digits of the largest ID (<= 38)
+                                             --width=N          numbers per range
+        03    battery banks (lines)          --width=N          batteries per bank
+        04    grid cells (size x size)       --fill=F           fraction of cells holding a roll
+        05    ranges, and as many IDs        --overlap=F        fraction of ranges overlapping the one before
+                                             --ids=N            number of ingredient IDs, defaults to --size
+        06    problems (columns)             --rows=N           numbers per problem
+                                             --digits=N         digits per number
+        07    grid cells (width x height)    --splitters=F      fraction of cells in splitter rows holding a '^'
+        08    junction boxes (lines)         --span=N           coordinate range
+        09    red tiles (polygon corners)    --span=N           coordinate range
+        10    machines (lines)               --lights=N         lights per machine
+                                             --buttons=N        buttons per machine
+                                             --max-presses=N    upper bound used to build the joltages
+
+    --seed=N makes the output reproducible, it defaults to 2025
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <charconv>
+#include <algorithm>
+
+
+struct GeneratorOptions
+{
+    int Day {0};
+    long long Size {1000};
+    std::uint64_t Seed {2025};
+    std::string OutputPath {};
+
+    //Shape options, -1 (or a negative fraction) means "use the day's default"
+    long long MaxClicks {-1};
+    long long Digits {-1};
+    long long Width {-1};
+    long long Ids {-1};
+    long long Rows {-1};
+    long long Span {-1};
+    long long Lights {-1};
+    long long Buttons {-1};
+    long long MaxPresses {-1};
+    double Fill {-1};
+    double Overlap {-1};
+    double Splitters {-1};
+};
+
+
+struct OutputBuffer
+{
+    //Big buffered writer, printing a billion lines through std::cout would take longer than solving them
+
+    std::FILE* p_File {stdout};
+    std::vector<char> Buffer = std::vector<char>(1 << 20);
+    std::size_t Used {0};
+
+    ~OutputBuffer() {Flush();}
+
+    void Flush()
+    {
+        if(Used){std::fwrite(Buffer.data(), 1, Used, p_File); Used = 0;}
+    }
+
+    void Put(char Character)
+    {
+        if(Used == Buffer.size()){Flush();}
+        Buffer[Used++] = Character;
+    }
+
+    void Put(std::string_view Text)
+    {
+        if(Used + Text.size() > Buffer.size()){Flush();}
+        if(Text.size() > Buffer.size()){std::fwrite(Text.data(), 1, Text.size(), p_File); return;}
+        std::copy(Text.begin(), Text.end(), Buffer.begin() + Used);
+        Used += Text.size();
+    }
+
+    void Put(std::uint64_t Number)
+    {
+        char Digits[24];
+        char* p_End {std::to_chars(Digits, Digits + sizeof(Digits), Number).ptr};
+        Put(std::string_view(Digits, p_End - Digits));
+    }
+
+    void Put(unsigned __int128 Number)
+    {
+        //std::to_chars stops at 64 bits, so write the digits out from the back
+        char Digits[40];
+        char* p_Begin {Digits + sizeof(Digits)};
+        do
+        {
+            *--p_Begin = (char)('0' + (int)(Number % 10));
+            Number /= 10;
+        } while(Number);
+        Put(std::string_view(p_Begin, Digits + sizeof(Digits) - p_Begin));
+    }
+};
+
+
+struct Random
+{
+    //splitmix64, fast and good enough for test data
+    std::uint64_t State;
+
+    std::uint64_t Next()
+    {
+        std::uint64_t Z {(State += 0x9E3779B97F4A7C15ULL)};
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBULL;
+        return Z ^ (Z >> 31);
+    }
+
+    //Uniform in [Low, High], both inclusive
+    std::uint64_t Between(std::uint64_t Low, std::uint64_t High) {return Low + Next() % (High - Low + 1);}
+
+    //Same, for 128 bit bounds. Spans that fit in 64 bits draw exactly what Between does, so old seeds still hold
+    unsigned __int128 WideBetween(unsigned __int128 Low, unsigned __int128 High)
+    {
+        if(High - Low <= UINT64_MAX){return Low + Between(0, (std::uint64_t)(High - Low));}
+
+        unsigned __int128 Wide {((unsigned __int128)Next() << 64) | Next()};
+        return Low + Wide % (High - Low + 1);
+    }
+
+    //True with probability Chance
+    bool Chance(double Probability) {return (Next() >> 11) * (1.0 / 9007199254740992.0) < Probability;}
+};
+
+
+long long Pick(long long Value, long long Default) {return Value >= 0 ? Value : Default;}
+double Pick(double Value, double Default) {return Value >= 0 ? Value : Default;}
+
+template<typename Number = std::uint64_t>
+Number PowerOfTen(int Exponent)
+{
+    Number Result {1};
+    for(int i_Exponent {0}; i_Exponent < Exponent; ++i_Exponent){Result *= 10;}
+    return Result;
+}
+
+
+void GenerateDay01(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //L68, R48, ... one rotation per line
+    std::uint64_t MaxClicks {(std::uint64_t)Pick(Options.MaxClicks, 999)};
+
+    for(long long i_Line {0}; i_Line < Options.Size; ++i_Line)
+    {
+        Out.Put(Rng.Chance(0.5) ? 'L' : 'R');
+        Out.Put(Rng.Between(1, MaxClicks));
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay02(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //11-22,95-115,... on a single line, ranges do not overlap and are spread out over the whole ID space
+    //IDs of 20 digits and up go past 64 bits, so the IDs are worked out in 128 bits, which take up to 38 digits
+    int Digits {(int)std::clamp(Pick(Options.Digits, 10LL), 2LL, 38LL)};
+    std::uint64_t Width {(std::uint64_t)Pick(Options.Width, 1000)};
+    unsigned __int128 MaxID {PowerOfTen<unsigned __int128>(Digits) - 1};
+    unsigned __int128 Stride {std::max<unsigned __int128>(MaxID / std::max(1LL, Options.Size), Width + 2)};
+
+    unsigned __int128 Start {11};
+    for(long long i_Range {0}; i_Range < Options.Size && Start + Width <= MaxID; ++i_Range)
+    {
+        if(i_Range){Out.Put(',');}
+        Out.Put(Start);
+        Out.Put('-');
+        Out.Put(Start + Rng.Between(0, Width));
+
+        Start += Stride - Rng.WideBetween(0, Stride / 4);
+    }
+    Out.Put('\n');
+}
+
+
+void GenerateDay03(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //Lines of digits 1-9, all the same width
+    long long Width {std::max(12LL, Pick(Options.Width, 100LL))};
+
+    for(long long i_Line {0}; i_Line < Options.Size; ++i_Line)
+    {
+        for(long long i_Battery {0}; i_Battery < Width; ++i_Battery){Out.Put((char)('1' + Rng.Next() % 9));}
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay04(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //Square grid of '@' and '.', --size is the total amount of cells
+    long long Side {std::max(1LL, (long long)std::sqrt((double)Options.Size))};
+    double Fill {Pick(Options.Fill, 0.6)};
+
+    for(long long Y {0}; Y < Side; ++Y)
+    {
+        for(long long X {0}; X < Side; ++X){Out.Put(Rng.Chance(Fill) ? '@' : '.');}
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay05(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //Ranges, a blank line, then ingredient IDs
+    //--overlap decides how often a range starts inside the one before it instead of after a gap
+    double Overlap {Pick(Options.Overlap, 0.2)};
+    long long Ids {Pick(Options.Ids, Options.Size)};
+    std::uint64_t Width {1000000};
+
+    std::uint64_t Start {1};
+    std::uint64_t LastStart {1};
+    std::uint64_t LastEnd {1};
+    for(long long i_Range {0}; i_Range < Options.Size; ++i_Range)
+    {
+        if(i_Range && Rng.Chance(Overlap)){Start = Rng.Between(LastStart, LastEnd);}
+        else{Start = LastEnd + Rng.Between(1, Width);}
+
+        std::uint64_t End {Start + Rng.Between(0, Width)};
+        Out.Put(Start);
+        Out.Put('-');
+        Out.Put(End);
+        Out.Put('\n');
+
+        LastStart = Start;
+        LastEnd = std::max(LastEnd, End);
+    }
+    Out.Put('\n');
+
+    for(long long i_ID {0}; i_ID < Ids; ++i_ID)
+    {
+        Out.Put(Rng.Between(1, LastEnd + Width));
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay06(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //Column aligned problems, numbers padded with spaces on a random side, operators on the last line
+    //Every problem is drawn up front so the rows can be written out line by line
+    long long Rows {std::max(1LL, Pick(Options.Rows, 4LL))};
+    int Digits {(int)std::clamp(Pick(Options.Digits, 4LL), 1LL, 4LL)};
+
+    std::vector<std::uint32_t> Numbers(Options.Size * Rows);
+    std::vector<std::uint8_t> PadLeft(Options.Size * Rows);
+    for(std::size_t i_Number {0}; i_Number < Numbers.size(); ++i_Number)
+    {
+        Numbers[i_Number] = Rng.Between(1, PowerOfTen(Rng.Between(1, Digits)) - 1);
+        PadLeft[i_Number] = Rng.Chance(0.5);
+    }
+
+    for(long long Row {0}; Row <= Rows; ++Row)
+    {
+        for(long long Problem {0}; Problem < Options.Size; ++Problem)
+        {
+            if(Problem){Out.Put(' ');}
+
+            if(Row == Rows)
+            {
+                Out.Put(Rng.Chance(0.5) ? '+' : '*');
+                for(int Pad {1}; Pad < Digits; ++Pad){Out.Put(' ');}
+                continue;
+            }
+
+            std::string Number {std::to_string(Numbers[Problem * Rows + Row])};
+            std::string Padding(Digits - Number.size(), ' ');
+            Out.Put(PadLeft[Problem * Rows + Row] ? Padding + Number : Number + Padding);
+        }
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay07(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //S in the middle of the top row, then alternating empty rows and rows with splitters
+    //Splitters never sit on the outer columns so beams can not leave the grid
+    long long Side {std::max(3LL, (long long)std::sqrt((double)Options.Size))};
+    double Splitters {Pick(Options.Splitters, 0.1)};
+
+    for(long long Y {0}; Y < Side; ++Y)
+    {
+        for(long long X {0}; X < Side; ++X)
+        {
+            if(Y == 0){Out.Put(X == Side / 2 ? 'S' : '.');}
+            else if(Y % 2 == 0 && X > 0 && X < Side - 1 && Rng.Chance(Splitters)){Out.Put('^');}
+            else{Out.Put('.');}
+        }
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay08(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //X,Y,Z junction box positions
+    std::uint64_t Span {(std::uint64_t)Pick(Options.Span, 100000)};
+
+    for(long long i_Line {0}; i_Line < Options.Size; ++i_Line)
+    {
+        Out.Put(Rng.Between(0, Span));
+        Out.Put(',');
+        Out.Put(Rng.Between(0, Span));
+        Out.Put(',');
+        Out.Put(Rng.Between(0, Span));
+        Out.Put('\n');
+    }
+}
+
+
+void GenerateDay09(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //Red tiles have to form a closed loop where every tile shares a row or column with the next one
+    //A random skyline does that: rise to a height, walk right, change height, walk right, ... then drop back down
+    //
+    //      (x1,h1)----(x2,h1)
+    //         |          |
+    //  (x0,h0)-(x1,h0)   (x2,h2)--(x3,h2)
+    //     |                          |
+    //  (x0,base)-----------------(x3,base)
+
+    std::uint64_t Span {(std::uint64_t)Pick(Options.Span, 100000)};
+    long long Columns {std::max(1LL, Options.Size / 2 - 1)};
+    std::uint64_t Step {std::max<std::uint64_t>(2, Span / (Columns + 1))};
+    std::uint64_t Base {1};
+
+    std::uint64_t X {1};
+    std::uint64_t Height {Rng.Between(Base + 1, Span)};
+    auto PutTile = [&Out](std::uint64_t TileX, std::uint64_t TileY)
+    {
+        Out.Put(TileX);
+        Out.Put(',');
+        Out.Put(TileY);
+        Out.Put('\n');
+    };
+
+    PutTile(X, Base);
+    PutTile(X, Height);
+    for(long long i_Column {0}; i_Column < Columns; ++i_Column)
+    {
+        X += Rng.Between(1, Step);
+        std::uint64_t NewHeight {Rng.Between(Base + 1, Span)};
+        if(NewHeight == Height){NewHeight = (NewHeight == Span) ? Base + 1 : NewHeight + 1;}
+
+        PutTile(X, Height);
+        PutTile(X, NewHeight);
+        Height = NewHeight;
+    }
+    X += Rng.Between(1, Step);
+    PutTile(X, Height);
+    PutTile(X, Base);
+}
+
+
+void GenerateDay10(GeneratorOptions& Options, Random& Rng, OutputBuffer& Out)
+{
+    //[.##.] (3) (1,3) (2) {3,5,4,7}
+    //The target lights are the result of pressing a random set of buttons, so problem one always has an answer
+    //The joltages are the result of pressing every button a random amount of times, same for problem two
+    int Lights {(int)std::clamp(Pick(Options.Lights, 6LL), 1LL, 64LL)};
+    int Buttons {(int)std::max(1LL, Pick(Options.Buttons, 6LL))};
+    std::uint64_t MaxPresses {(std::uint64_t)Pick(Options.MaxPresses, 20LL)};
+
+    for(long long i_Machine {0}; i_Machine < Options.Size; ++i_Machine)
+    {
+        std::vector<std::vector<int>> ButtonLights(Buttons);
+        std::vector<std::uint64_t> Joltages(Lights, 0);
+        std::string Target(Lights, '.');
+
+        for(std::vector<int>& Button : ButtonLights)
+        {
+            for(int Light {0}; Light < Lights; ++Light)
+            {
+                if(Rng.Chance(0.4)){Button.emplace_back(Light);}
+            }
+            if(Button.empty()){Button.emplace_back(Rng.Between(0, Lights - 1));}
+
+            bool Pressed {Rng.Chance(0.5)};
+            std::uint64_t Presses {Rng.Between(0, MaxPresses)};
+            for(int Light : Button)
+            {
+                if(Pressed){Target[Light] = (Target[Light] == '.') ? '#' : '.';}
+                Joltages[Light] += Presses;
+            }
+        }
+
+        Out.Put('[');
+        Out.Put(Target);
+        Out.Put(']');
+        for(std::vector<int>& Button : ButtonLights)
+        {
+            Out.Put(" (");
+            for(int i_Light {0}; i_Light < (int)Button.size(); ++i_Light)
+            {
+                if(i_Light){Out.Put(',');}
+                Out.Put((std::uint64_t)Button[i_Light]);
+            }
+            Out.Put(')');
+        }
+        Out.Put(" {");
+        for(int Light {0}; Light < Lights; ++Light)
+        {
+            if(Light){Out.Put(',');}
+            Out.Put(Joltages[Light]);
+        }
+        Out.Put("}\n");
+    }
+}
+
+
+bool ParseGeneratorOptions(int argc, char* argv[], GeneratorOptions& Options)
+{
+    //Every option is --name=value
+    std::map<std::string, long long*> IntegerOptions {
+        {"--size", &Options.Size}, {"--max-clicks", &Options.MaxClicks}, {"--digits", &Options.Digits},
+        {"--width", &Options.Width}, {"--ids", &Options.Ids}, {"--rows", &Options.Rows}, {"--span", &Options.Span},
+        {"--lights", &Options.Lights}, {"--buttons", &Options.Buttons}, {"--max-presses", &Options.MaxPresses}};
+    std::map<std::string, double*> FractionOptions {
+        {"--fill", &Options.Fill}, {"--overlap", &Options.Overlap}, {"--splitters", &Options.Splitters}};
+
+    for(int i_Argument {1}; i_Argument < argc; ++i_Argument)
+    {
+        std::string Argument {argv[i_Argument]};
+        std::size_t Equals {Argument.find('=')};
+        std::string Name {Argument.substr(0, Equals)};
+        std::string Value {Equals == std::string::npos ? "" : Argument.substr(Equals + 1)};
+
+        if(Value.empty())
+        {
+            std::cout << "Option needs a value: " << Argument << std::endl;
+            return false;
+        }
+
+        if(Name == "--day"){Options.Day = std::stoi(Value);}
+        else if(Name == "--seed"){Options.Seed = std::stoull(Value);}
+        else if(Name == "--output"){Options.OutputPath = Value;}
+        //Accept 1e6 style sizes, handy when sweeping
+        else if(IntegerOptions.count(Name)){*IntegerOptions[Name] = (long long)std::stod(Value);}
+        else if(FractionOptions.count(Name)){*FractionOptions[Name] = std::stod(Value);}
+        else
+        {
+            std::cout << "Unknown option: " << Argument << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+int main(int argc, char* argv[])
+{
+    GeneratorOptions Options {};
+    if(!ParseGeneratorOptions(argc, argv, Options) || Options.Day < 1 || Options.Day > 10)
+    {
+        std::cout << "Usage: " << argv[0] << " --day=N [--size=N] [--seed=N] [--output=FILE] [shape options]" << std::endl;
+        return 1;
+    }
+
+    void (*Generators[])(GeneratorOptions&, Random&, OutputBuffer&) {
+        GenerateDay01, GenerateDay02, GenerateDay03, GenerateDay04, GenerateDay05,
+        GenerateDay06, GenerateDay07, GenerateDay08, GenerateDay09, GenerateDay10};
+
+    OutputBuffer Out {};
+    if(!Options.OutputPath.empty())
+    {
+        Out.p_File = std::fopen(Options.OutputPath.c_str(), "wb");
+        if(!Out.p_File)
+        {
+            std::cout << "Cannot open file " << Options.OutputPath << std::endl;
+            return 1;
+        }
+    }
+
+    Random Rng {Options.Seed};
+    Generators[Options.Day - 1](Options, Rng, Out);
+
+    Out.Flush();
+    if(Out.p_File != stdout){std::fclose(Out.p_File);}
+
+    return 0;
+}